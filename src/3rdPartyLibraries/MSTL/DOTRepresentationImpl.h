@@ -74,7 +74,7 @@ T escape_double_quotes(const T & input) {
 template<class NodeType>
 void 
 DOTRepresentation<NodeType>::addNode(NodeType node, std::string nodelabel, std::string option) {
-  (*dotout) << nodeName(node) << "[label=\"" << escape_double_quotes(nodelabel) << "\" " << option << "];" << std::endl;
+  (*dotout) << nodeName(node) << "[label=\"" << escape_double_quotes(nodelabel) << "\" " << option << "];\n";
 }
 
 template<class NodeType>
@@ -83,7 +83,7 @@ addEdge(NodeType node1, TraceType downtrace, TraceType uptrace, std::string edge
   (*dotout) << nodeName(node1)
 	    << " -> "
 	    << nodeName(node2)
-	    << "[label=\"" << downtrace << ":" << uptrace << ":"<< edgelabel << "\" " << option << " dir=both];" << std::endl;
+	    << "[label=\"" << downtrace << ":" << uptrace << ":"<< edgelabel << "\" " << option << " dir=both];\n";
 }
  
 // for edges to revisited nodes (there is no uptrace)
@@ -93,7 +93,7 @@ addEdge(NodeType node1, TraceType downtrace, std::string edgelabel, NodeType nod
   (*dotout) << nodeName(node1)
 	    << " -> "
 	    << nodeName(node2)
-	    << "[label=\"" << downtrace << ":" << edgelabel << "\" " << option << " arrowhead=odot];" << std::endl;
+	    << "[label=\"" << downtrace << ":" << edgelabel << "\" " << option << " arrowhead=odot];\n";
 }
  
 // for edges to revisited nodes (there is no uptrace)
@@ -103,7 +103,7 @@ addEdge(NodeType node1, std::string edgelabel, NodeType node2, std::string optio
   (*dotout) << nodeName(node1)
 	    << " -> "
 	    << nodeName(node2)
-	   << "[label=\"" << edgelabel << "\" " << option << " ];" << std::endl;
+	   << "[label=\"" << edgelabel << "\" " << option << " ];\n";
 }
 
 // for edges to revisited nodes (there is no uptrace)
@@ -121,10 +121,10 @@ addNullValue(NodeType node, std::string nodelabel, std::string edgelabel, std::s
   (*dotout) << nodeName(node)
 	    << " -> "
 	    << nullNodeName(node,edgelabel)
-	    << "[label=\"" << edgelabel << "\" " << "dir=none "<< option << "];" << std::endl;
+	    << "[label=\"" << edgelabel << "\" " << "dir=none "<< option << "];\n";
   // node
   (*dotout) << nullNodeName(node,edgelabel)
-	    << "[label=\"" << nodelabel << "\" shape=diamond "<< option <<"];" << std::endl;
+	    << "[label=\"" << nodelabel << "\" shape=diamond "<< option <<"];\n";
 }
 
 template<class NodeType>
@@ -135,10 +135,10 @@ addNullValue(NodeType node, TraceType trace, std::string varname, std::string op
   (*dotout) << "n_" << node
 	    << " -> "
 	    << "n_" << node << "__" << varname << "__null"
-	    << "[label=\"" << trace << ":" << varname << "\" " << "dir=none "<< option << "];" << std::endl;
+	    << "[label=\"" << trace << ":" << varname << "\" " << "dir=none "<< option << "];\n";
   // node
   (*dotout) << "n_" << node << "__" << varname << "__null"
-	    << "[label=\""<< trace << ":\" shape=diamond "<< option <<"];" << std::endl;
+	    << "[label=\""<< trace << ":\" shape=diamond "<< option <<"];\n";
 }
  
 template<class NodeType>
@@ -147,9 +147,9 @@ addEmptyContainer(NodeType node, TraceType trace, std::string varname, std::stri
   (*dotout) << "n_" << node // node: holding null-reference to STL container, using [] to represent container-reference 
 	    << " -> "
 	    << "n_" << node << "__" << varname << "__null"
-	    << "["<< "label=\"" << trace << ":" << varname << "[]\"" << " dir=none ];" << std::endl;
+	    << "["<< "label=\"" << trace << ":" << varname << "[]\"" << " dir=none ];\n";
   (*dotout) << "n_" << node << "__" << varname << "__null"
-	    << "[label=\"\" shape=diamond ];" << std::endl; // dot-null node
+	    << "[label=\"\" shape=diamond ];\n"; // dot-null node
 }
 
 template<class NodeType>
@@ -9,31 +9,54 @@
 #define JSONGENERATION_H
 
 #include <iostream>
-#include "nlohmann/json.hpp"
+#include <fstream>
+#include <vector>
 #include "AstProcessing.h"
 
 class JSONInheritedAttribute {
 public:
-  explicit JSONInheritedAttribute() {}
+  explicit JSONInheritedAttribute(size_t depth = 0) : depth(depth) {}
   ~JSONInheritedAttribute() {}
+
+  // distance from the node where the traversal started
+  size_t depth;
 };
 
 class JSONGeneration : public SgTopDownProcessing<JSONInheritedAttribute> {
 public:
-  JSONGeneration() { }
+  JSONGeneration() : firstNode(true), firstMember(true) { }
   virtual void generate(std::string filename, SgNode *node);
 
 protected:
   virtual JSONInheritedAttribute evaluateInheritedAttribute(SgNode *node, JSONInheritedAttribute inheritedValue);
 
-  nlohmann::json jsonDocument;
-
   virtual void handle_node(SgNode *node, JSONInheritedAttribute inheritedValue);
+
+  // The document is streamed to the file rather than built in memory: json_setup() opens the file and the top-level
+  // object, each node is written as one member of that object between json_begin_node() and json_end_node(), and
+  // json_finalize() closes the object and the file. Both throw std::runtime_error if the file cannot be opened or
+  // written.
   void json_setup(std::string filename);
   void json_finalize();
+  void json_begin_node(const std::string &key);
+  void json_end_node();
+
+  // Members of the current node's object. Strings are escaped as needed.
+  void json_string_member(const char *name, const std::string &value);
+  void json_int_member(const char *name, long value);
+  void json_bool_member(const char *name, bool value);
+
+  // Writes the name of a member whose value (e.g., an array or an object) the caller writes to the returned stream,
+  // using json_write_string() for any strings it contains.
+  std::ostream& json_member(const char *name);
+  static void json_write_string(std::ostream &out, const std::string &value);
 
 private:
   std::string filename;
+  std::ofstream jsonFile;
+  std::vector<char> jsonBuffer;
+  bool firstNode;
+  bool firstMember;
 };
 
 #endif
@@ -2,6 +2,8 @@
 #ifndef ROSE_AST_Checker_H
 #define ROSE_AST_Checker_H
 
+#include <cstddef>
+
 namespace Rose { namespace AST {
 
 /**
@@ -15,6 +17,24 @@ namespace Rose { namespace AST {
  */
 namespace Checker {
 
+/**
+ * \brief Controls how the checkers visit the nodes of the memory pools
+ *
+ * Checking every node of a production-size AST can cost more than the transformation being checked.
+ * Checkers that visit every allocated node distribute the nodes over multiple threads, and can verify a
+ * deterministic sample of the nodes instead of all of them. A node is selected from its position in the
+ * memory pools and the seed, so the same seed selects the same nodes of the same AST.
+ *
+ * Defects are recorded after the threads finish, in memory pool order, so the recorded defects do not
+ * depend on the number of threads.
+ */
+struct Settings {
+  size_t threads{1};  //!< Number of threads used by each checker (0 for the number of hardware threads)
+  double sample{1.0}; //!< Fraction of the nodes that are checked, in (0, 1]
+  unsigned seed{0};   //!< Seed used to select the sampled nodes
+};
+extern Settings settings; //!< Used by all checkers, set by the -rose:ast:checker:threads/sample/seed options
+
 /**
  * \brief Apply all existing Checkers
  * @param project
@@ -43,7 +63,7 @@ bool integrity(SgProject * project);
  * @param project
  * @return true if no defect was found
  * 
- * Check the edges out of all allocated nodes in the memory pool.
+ * Check the edges out of all allocated nodes in the memory pool (or the sample of them selected by Checker::settings).
  * For each (non-null) edge, it looks for the pointer in all memory pools.
  * If not found, an IntegrityEdgeDefect is produced with Reason::invalid.
  * If found in an unexpected memory pool, an IntegrityEdgeDefect is produced with Reason::incompatible.
@@ -32,9 +32,11 @@ class BinaryLoaderPe;
 using BinaryLoaderPePtr = Sawyer::SharedPointer<BinaryLoaderPe>; /**< Refernce counting pointer. */
 class BinaryToSource;
 class CodeInserter;
+class ConcreteEmulator;
 class ConcreteLocation;
 class DataFlow;
 class Demangler;
+class DwarfIndex;
 class FeasiblePath;
 class FunctionCall;
 class FunctionSimilarity;
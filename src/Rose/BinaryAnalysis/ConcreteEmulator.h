@@ -0,0 +1,249 @@
+#ifndef ROSE_BinaryAnalysis_ConcreteEmulator_H
+#define ROSE_BinaryAnalysis_ConcreteEmulator_H
+#include <featureTests.h>
+#ifdef ROSE_ENABLE_BINARY_ANALYSIS
+
+#include <Rose/BinaryAnalysis/BasicTypes.h>
+#include <Rose/BinaryAnalysis/InstructionSemantics/ConcreteSemantics.h>
+#include <Rose/BinaryAnalysis/Partitioner2/BasicTypes.h>
+#include <Rose/BinaryAnalysis/RegisterDescriptor.h>
+#include <Rose/Exception.h>
+
+#include <Sawyer/Optional.h>
+#include <map>
+#include <unordered_map>
+#include <vector>
+
+namespace Rose {
+namespace BinaryAnalysis {
+
+/** Fast concrete execution of machine instructions.
+ *
+ *  Running @ref InstructionSemantics::ConcreteSemantics through a dispatcher creates a heap-allocated semantic value for every
+ *  register read and every intermediate result, which makes it too slow for replaying long executions. This emulator instead
+ *  decodes each basic block the first time it's reached into a compact array of operations whose operands refer to registers,
+ *  immediates, and memory addresses directly, and executes those operations on unboxed 64-bit register values.
+ *
+ *  The emulator covers the common x86 integer instructions: data movement, address computation, addition, subtraction and
+ *  the bitwise operations with their status flags, stack operations, and branches. Every other instruction, and every
+ *  instruction of other architectures, is executed by the partitioner's ConcreteSemantics dispatcher, so any instruction that
+ *  ConcreteSemantics supports can be emulated. The results are identical to running ConcreteSemantics alone, including the
+ *  values ConcreteSemantics gives to status flags that the architecture leaves undefined.
+ *
+ *  Memory is a @ref InstructionSemantics::ConcreteSemantics::MemoryState, which is shared with the dispatcher. Registers that
+ *  the decoded operations use are cached in the emulator and written back to the dispatcher's register state only when an
+ *  instruction needs the dispatcher, or when @ref semanticState is called.
+ *
+ *  When @ref Settings::differential is set, every instruction is also executed by a separate ConcreteSemantics state, and the
+ *  registers and memory written by the two are compared after each instruction. A @ref Mismatch exception is thrown at the
+ *  first difference.
+ *
+ *  The decoded blocks are read through the partitioner's instruction provider, so self-modifying code is not detected; call
+ *  @ref invalidate after modifying instructions. Objects of this class are not thread safe. */
+class ConcreteEmulator {
+public:
+    /** Exceptions for emulation errors. */
+    class Exception: public Rose::Exception {
+    public:
+        /** Construct an exception with an error message. */
+        explicit Exception(const std::string &s): Rose::Exception(s) {}
+        ~Exception() throw() {}
+    };
+
+    /** Exception thrown when differential checking finds a difference. */
+    class Mismatch: public Exception {
+    public:
+        rose_addr_t va;                                 /**< Address of the instruction whose results differed. */
+
+        /** Construct an exception for the instruction at the specified address. */
+        Mismatch(rose_addr_t va, const std::string &s): Exception(s), va(va) {}
+        ~Mismatch() throw() {}
+    };
+
+    /** Settings that control the emulator. */
+    struct Settings {
+        /** Check each instruction's results against ConcreteSemantics.
+         *
+         *  This is much slower than ConcreteSemantics alone and is intended for testing. */
+        bool differential = false;
+
+        /** Maximum number of instructions per decoded block. */
+        size_t maxBlockSize = 256;
+    };
+
+private:
+    // Bits [offset, offset+nBits) of a cached register. The register is absent if nBits is zero.
+    struct Reg {
+        uint16_t slot = 0;
+        uint8_t offset = 0;
+        uint8_t nBits = 0;
+    };
+
+    enum class OperandKind: uint8_t { NONE, REGISTER, IMMEDIATE, MEMORY };
+
+    // An instruction operand. Memory addresses are segment + base + index * scale + value.
+    struct Operand {
+        OperandKind kind = OperandKind::NONE;
+        uint8_t nBits = 0;                              // width of the operand's value
+        Reg reg;                                        // register operand, or memory base register
+        Reg index;                                      // memory index register
+        Reg segment;                                    // memory segment register
+        uint64_t scale = 0;                             // memory index scale factor
+        uint64_t value = 0;                             // immediate value, or memory displacement
+    };
+
+    enum class Opcode: uint8_t {
+        FALLBACK, NOP, MOV, MOVZX, MOVSX, LEA, ADD, SUB, CMP, AND, OR, XOR, TEST, INC, DEC, NEG, NOT,
+        PUSH, POP, CALL, RET, JMP, JCC, SETCC, CMOVCC
+    };
+
+    enum class Condition: uint8_t { O, NO, B, AE, E, NE, BE, A, S, NS, P, NP, L, GE, LE, G };
+
+    // One decoded instruction.
+    struct Op {
+        Opcode opcode = Opcode::FALLBACK;
+        Condition condition = Condition::O;
+        SgAsmInstruction *insn = nullptr;
+        rose_addr_t fallThroughVa = 0;
+        Operand dst;                                    // first operand
+        Operand src;                                    // second operand
+        Reg sp;                                         // stack pointer for stack operations
+    };
+
+    struct Block {
+        std::vector<Op> ops;
+    };
+
+    Partitioner2::PartitionerConstPtr partitioner_;
+    Settings settings_;
+    RegisterDictionaryPtr registers_;
+    InstructionSemantics::BaseSemantics::RiscOperatorsPtr ops_;
+    InstructionSemantics::BaseSemantics::DispatcherPtr dispatcher_;
+    InstructionSemantics::ConcreteSemantics::MemoryStatePtr memory_;
+    bool isX86_ = false;                                // whether to decode x86 instructions into operations
+    size_t addrWidth_ = 0;                              // width of memory addresses in bits
+    RegisterDescriptor ipRegister_;                     // instruction pointer
+    Reg sp16_, sp32_, sp64_, anySp_, ss_;               // stack pointers and stack segment
+    Reg cf_, pf_, af_, zf_, sf_, of_;                   // status flags
+
+    std::vector<uint64_t> values_;                      // cached register values indexed by slot
+    std::vector<RegisterDescriptor> slotRegisters_;     // full register for each slot
+    std::map<std::pair<unsigned, unsigned>, size_t> slots_; // slot for each register major and minor number
+    rose_addr_t ip_ = 0;                                // address of the next instruction
+    std::unordered_map<rose_addr_t, Block> blocks_;     // decoded blocks by starting address
+    size_t nExecuted_ = 0;
+    size_t nFallbacks_ = 0;
+
+    // Differential checking
+    InstructionSemantics::BaseSemantics::RiscOperatorsPtr refOps_;
+    InstructionSemantics::BaseSemantics::DispatcherPtr refDispatcher_;
+    InstructionSemantics::ConcreteSemantics::MemoryStatePtr refMemory_;
+    AddressIntervalSet stores_;                         // bytes written by the current operation
+
+public:
+    /** Construct an emulator for a partitioner's architecture.
+     *
+     *  The emulator's memory is initially empty and its registers are zero. The partitioner must have instruction semantics
+     *  for its architecture. */
+    explicit ConcreteEmulator(const Partitioner2::PartitionerConstPtr&, const Settings &settings = Settings());
+
+    /** Settings given to the constructor. */
+    const Settings& settings() const {
+        return settings_;
+    }
+
+    /** Memory state.
+     *
+     *  This is the memory of the emulated process, which can be initialized with @ref
+     *  InstructionSemantics::ConcreteSemantics::MemoryState::memoryMap. */
+    InstructionSemantics::ConcreteSemantics::MemoryStatePtr memory() const {
+        return memory_;
+    }
+
+    /** Property: Address of the next instruction to execute.
+     *
+     * @{ */
+    rose_addr_t ip() const {
+        return ip_;
+    }
+    void ip(rose_addr_t va) {
+        ip_ = va;
+    }
+    /** @} */
+
+    /** Read a register.
+     *
+     *  The register must be at most 64 bits wide. */
+    uint64_t readRegister(RegisterDescriptor);
+
+    /** Write a register.
+     *
+     *  The register must be at most 64 bits wide. Bits of the value that don't fit in the register are ignored. */
+    void writeRegister(RegisterDescriptor, uint64_t value);
+
+    /** Semantic state of the emulator.
+     *
+     *  Returns the ConcreteSemantics state used by the dispatcher after updating it with the registers cached by the emulator.
+     *  If the caller modifies registers in the returned state then it must call @ref reloadRegisters before continuing the
+     *  emulation. */
+    InstructionSemantics::BaseSemantics::StatePtr semanticState();
+
+    /** Reload cached registers from the semantic state. */
+    void reloadRegisters();
+
+    /** Execute instructions.
+     *
+     *  Executes instructions starting at @ref ip until @p maxInstructions have been executed or the next instruction would be
+     *  at @p stopVa. Returns the number of instructions executed. Throws an @ref Exception if there's no instruction at the
+     *  instruction pointer, a @ref Mismatch if differential checking finds a difference, and whatever ConcreteSemantics
+     *  throws for instructions it can't execute. */
+    size_t run(size_t maxInstructions, Sawyer::Optional<rose_addr_t> stopVa = Sawyer::Nothing());
+
+    /** Forget all decoded blocks. */
+    void invalidate();
+
+    /** Total number of instructions executed. */
+    size_t nExecuted() const {
+        return nExecuted_;
+    }
+
+    /** Number of executed instructions that were executed by the ConcreteSemantics dispatcher. */
+    size_t nFallbacks() const {
+        return nFallbacks_;
+    }
+
+private:
+    // Registers
+    Sawyer::Optional<Reg> registerOperand(RegisterDescriptor);
+    uint64_t read(const Reg&) const;
+    void write(const Reg&, uint64_t value);
+    void flushRegisters();
+
+    // Decoding
+    const Block& block(rose_addr_t va);
+    Op decode(SgAsmInstruction*);
+    bool decodeOperand(SgAsmExpression*, Operand&, rose_addr_t fallThroughVa);
+    bool decodeAddress(SgAsmExpression*, Operand&, rose_addr_t fallThroughVa);
+
+    // Execution
+    void execute(const Op&);
+    void fallback(const Op&);
+    bool condition(Condition) const;
+    uint64_t effectiveAddress(const Operand&) const;
+    uint64_t readOperand(const Operand&);
+    void writeOperand(const Operand&, uint64_t value);
+    uint64_t readMemory(uint64_t va, size_t nBits);
+    void writeMemory(uint64_t va, size_t nBits, uint64_t value);
+    uint64_t add(uint64_t a, uint64_t b, size_t nBits, bool subtract);
+    void setResultFlags(uint64_t result, size_t nBits);
+
+    // Differential checking
+    void startChecking();
+    void check(const Op&);
+};
+
+} // namespace
+} // namespace
+
+#endif
+#endif
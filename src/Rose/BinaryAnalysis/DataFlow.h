@@ -8,10 +8,12 @@
 #include <Rose/Exception.h>
 #include <Rose/BinaryAnalysis/InstructionSemantics/SymbolicSemantics.h>
 
+#include <algorithm>
 #include <boost/lexical_cast.hpp>
 #include <list>
 #include <Sawyer/GraphTraversal.h>
 #include <Sawyer/DistinctList.h>
+#include <set>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -105,6 +107,20 @@ public:
         explicit NotConverging(const std::string &s): Exception(s) {}
     };
 
+    /** Order in which a data-flow @ref Engine visits pending vertices. */
+    enum class Scheduling {
+        /** Visit vertices in the order they were added to the work list. */
+        WORKLIST,
+
+        /** Visit the pending vertex that's earliest in reverse postorder.
+         *
+         *  The order is computed after each reset by a depth-first search from the starting vertices. Since a loop head
+         *  precedes its body in this order, the body of a loop is iterated until its head stabilizes before vertices after
+         *  the loop are visited, and vertices with several predecessors are normally visited once all of their forward
+         *  predecessors have been merged into them. */
+        REVERSE_POSTORDER
+    };
+
 private:
     InstructionSemantics::BaseSemantics::RiscOperatorsPtr userOps_;   // operators (and state) provided by the user
     InstructionSemantics::DataFlowSemantics::RiscOperatorsPtr dfOps_; // data-flow operators (which point to user ops)
@@ -326,12 +342,17 @@ public:
         TransferFunction &xfer_;
         MergeFunction merge_;
         VertexStates incomingState_;                    // incoming data-flow state per CFG vertex ID
-        VertexStates outgoingState_;                    // outgoing data-flow state per CFG vertex ID
+        VertexStates outgoingState_;                    // outgoing data-flow state per CFG vertex ID if savingFinalStates_
         typedef Sawyer::Container::DistinctList<size_t> WorkList;
         WorkList workList_;                             // CFG vertex IDs to be visited, last in first out w/out duplicates
         size_t maxIterations_;                          // max number of iterations to allow
         size_t nIterations_;                            // number of iterations since last reset
         PathFeasibility isFeasible_;                    // predicate to test path feasibility
+        Scheduling scheduling_;                         // order in which pending vertices are visited
+        bool savingFinalStates_;                        // whether to store the outgoing state of each vertex
+        std::vector<size_t> rank_;                      // reverse postorder rank per vertex ID, empty until computed after reset
+        std::vector<size_t> rankToVertex_;              // vertex ID per reverse postorder rank
+        std::set<size_t> pendingRanks_;                 // ranks of vertices to be visited when scheduling by rank
 
     public:
         /** Constructor.
@@ -341,7 +362,8 @@ public:
          *  copied. */
         Engine(const Cfg &cfg, TransferFunction &xfer, MergeFunction merge = MergeFunction(),
                PathFeasibility isFeasible = PathFeasibility())
-            : cfg_(cfg), xfer_(xfer), merge_(merge), maxIterations_(-1), nIterations_(0), isFeasible_(isFeasible) {
+            : cfg_(cfg), xfer_(xfer), merge_(merge), maxIterations_(-1), nIterations_(0), isFeasible_(isFeasible),
+              scheduling_(Scheduling::WORKLIST), savingFinalStates_(true) {
             reset();
         }
 
@@ -359,8 +381,12 @@ public:
             incomingState_.clear();
             incomingState_.resize(cfg_.nVertices(), initialState);
             outgoingState_.clear();
-            outgoingState_.resize(cfg_.nVertices(), initialState);
+            if (savingFinalStates_)
+                outgoingState_.resize(cfg_.nVertices(), initialState);
             workList_.clear();
+            pendingRanks_.clear();
+            rank_.clear();                              // the CFG may have changed and the starting vertices may differ
+            rankToVertex_.clear();
             nIterations_ = 0;
         }
 
@@ -396,24 +422,48 @@ public:
          *
          *  The number of times runOneIteration was called since the last reset. */
         size_t nIterations() const { return nIterations_; }
-        
+
+        /** Property: Order in which pending vertices are visited.
+         *
+         *  The default is @ref Scheduling::WORKLIST. This should be set before any starting vertices are inserted.
+         *
+         * @{ */
+        Scheduling scheduling() const { return scheduling_; }
+        void scheduling(Scheduling s) { scheduling_ = s; }
+        /** @} */
+
+        /** Property: Whether to save the outgoing state of each vertex.
+         *
+         *  The engine itself never reads the outgoing states; they're saved only so they can be returned by @ref getFinalState
+         *  and @ref getFinalStates. Analyses that need only incoming states can clear this property to free each outgoing
+         *  state as soon as it has been merged into the successors. When cleared, @ref getFinalState returns a
+         *  default-constructed state and @ref getFinalStates returns an empty vector. Changing this property takes effect at
+         *  the next @ref reset.
+         *
+         * @{ */
+        bool savingFinalStates() const { return savingFinalStates_; }
+        void savingFinalStates(bool b) { savingFinalStates_ = b; }
+        /** @} */
+
         /** Runs one iteration.
          *
          *  Runs one step of data-flow analysis by consuming the first item on the work list.  Returns false if the
          *  work list is empty (before of after the iteration). */
         bool runOneIteration() {
             using namespace Diagnostics;
-            if (!workList_.isEmpty()) {
+            if (!isWorkListEmpty()) {
                 if (++nIterations_ > maxIterations_) {
                     throw NotConverging("data-flow max iterations reached"
                                         " (max=" + StringUtility::numberToString(maxIterations_) + ")");
                 }
-                size_t cfgVertexId = workList_.popFront();
+                size_t cfgVertexId = popWorkList();
                 if (mlog[DEBUG]) {
                     mlog[DEBUG] <<prefix() <<"runOneIteration: vertex #" <<cfgVertexId <<"\n";
                     mlog[DEBUG] <<prefix() <<"  remaining worklist is {";
                     for (size_t id: workList_.items())
                         mlog[DEBUG] <<" " <<id;
+                    for (size_t rank: pendingRanks_)
+                        mlog[DEBUG] <<" " <<rankToVertex_[rank];
                     mlog[DEBUG] <<" }\n";
                 }
                 
@@ -426,7 +476,9 @@ public:
                                 <<StringUtility::prefixLines(xfer_.toString(state), prefix() + "    ") <<"\n";
                 }
 
-                state = outgoingState_[cfgVertexId] = xfer_(cfg_, cfgVertexId, state);
+                state = xfer_(cfg_, cfgVertexId, state);
+                if (savingFinalStates_)
+                    outgoingState_[cfgVertexId] = state;
                 if (mlog[DEBUG]) {
                     mlog[DEBUG] <<prefix() <<"  outgoing state for vertex #" <<cfgVertexId <<":\n"
                                 <<StringUtility::prefixLines(xfer_.toString(state), prefix() + "    ") <<"\n";
@@ -448,19 +500,19 @@ public:
                                         <<StringUtility::prefixLines(xfer_.toString(incomingState_[nextVertexId]),
                                                                      prefix() + "      ", false) <<"\n";
                         }
-                        workList_.pushBack(nextVertexId);
+                        pushWorkList(nextVertexId);
                     } else {
                         SAWYER_MESG(mlog[DEBUG]) <<prefix() <<"    merged with vertex #" <<nextVertexId <<" (no change)\n";
                     }
                 }
             }
-            return !workList_.isEmpty();
+            return !isWorkListEmpty();
         }
 
         /** Add a starting vertex. */
         void insertStartingVertex(size_t startVertexId, const State &initialState) {
             incomingState_[startVertexId] = initialState;
-            workList_.pushBack(startVertexId);
+            pushWorkList(startVertexId);
         }
 
         /** Run data-flow until it reaches a fixed point.
@@ -497,9 +549,10 @@ public:
         /** Return the outgoing state for the specified CFG vertex.
          *
          *  This is a pointer to the outgoing state for the vertex as of the latest data-flow iteration. If the data-flow has
-         *  not processed this vertex then it is likely to be a null pointer. */
+         *  not processed this vertex, or if outgoing states are not being saved (see @ref savingFinalStates), then it is likely
+         *  to be a null pointer. */
         State getFinalState(size_t cfgVertexId) const {
-            return outgoingState_[cfgVertexId];
+            return cfgVertexId < outgoingState_.size() ? outgoingState_[cfgVertexId] : State();
         }
 
         /** All incoming states.
@@ -517,6 +570,85 @@ public:
         const VertexStates& getFinalStates() const {
             return outgoingState_;
         }
+
+    private:
+        bool isWorkListEmpty() const {
+            return workList_.isEmpty() && pendingRanks_.empty();
+        }
+
+        // Vertices are scheduled by rank once the ranks are known. Vertices inserted before that are held in the plain work list
+        // and become the roots of the depth-first search that computes the ranks.
+        void pushWorkList(size_t vertexId) {
+            if (Scheduling::REVERSE_POSTORDER == scheduling_ && !rank_.empty()) {
+                pendingRanks_.insert(rank_[vertexId]);
+            } else {
+                workList_.pushBack(vertexId);
+            }
+        }
+
+        size_t popWorkList() {
+            if (Scheduling::REVERSE_POSTORDER == scheduling_) {
+                if (rank_.empty())
+                    computeRanks(workList_.items());
+                for (size_t id: workList_.items())
+                    pendingRanks_.insert(rank_[id]);
+                workList_.clear();
+                ASSERT_forbid(pendingRanks_.empty());
+                const size_t rank = *pendingRanks_.begin();
+                pendingRanks_.erase(pendingRanks_.begin());
+                return rankToVertex_[rank];
+            } else {
+                return workList_.popFront();
+            }
+        }
+
+        // Rank the vertices in reverse postorder of a depth-first search from the specified roots, followed by the vertices that
+        // are not reachable from the roots.
+        template<class Roots>
+        void computeRanks(const Roots &roots) {
+            typedef typename Cfg::ConstVertexIterator VertexIter;
+            typedef typename Cfg::ConstEdgeIterator EdgeIter;
+            const size_t nVertices = cfg_.nVertices();
+            std::vector<bool> seen(nVertices, false);
+            std::vector<std::pair<VertexIter, EdgeIter>> stack;
+            rankToVertex_.clear();
+            rankToVertex_.reserve(nVertices);
+
+            auto search = [&](size_t rootId) {
+                if (rootId >= nVertices || seen[rootId])
+                    return;
+                seen[rootId] = true;
+                VertexIter root = cfg_.findVertex(rootId);
+                stack.push_back(std::make_pair(root, root->outEdges().begin()));
+                while (!stack.empty()) {
+                    VertexIter vertex = stack.back().first;
+                    EdgeIter &edge = stack.back().second;
+                    if (edge == vertex->outEdges().end()) {
+                        rankToVertex_.push_back(vertex->id()); // postorder for now
+                        stack.pop_back();
+                    } else {
+                        VertexIter target = edge->target();
+                        ++edge;
+                        if (!seen[target->id()]) {
+                            seen[target->id()] = true;
+                            stack.push_back(std::make_pair(target, target->outEdges().begin()));
+                        }
+                    }
+                }
+            };
+
+            for (size_t id: roots)
+                search(id);
+            const size_t nReached = rankToVertex_.size();
+            std::reverse(rankToVertex_.begin(), rankToVertex_.end());
+            for (size_t id = 0; id < nVertices; ++id)
+                search(id);
+            std::reverse(rankToVertex_.begin() + nReached, rankToVertex_.end());
+
+            rank_.resize(nVertices);
+            for (size_t rank = 0; rank < rankToVertex_.size(); ++rank)
+                rank_[rankToVertex_[rank]] = rank;
+        }
     };
 };
 
@@ -5,6 +5,7 @@
 
 #include <Rose/BinaryAnalysis/CallingConvention.h>
 #include <Rose/BinaryAnalysis/Disassembler/BasicTypes.h>
+#include <Rose/BinaryAnalysis/Disassembler/DecodedInstruction.h>
 #include <Rose/BinaryAnalysis/Disassembler/Exception.h>
 #include <Rose/BinaryAnalysis/InstructionSemantics/BaseSemantics.h>
 #include <Rose/BinaryAnalysis/MemoryMap.h>
@@ -260,6 +261,29 @@ public:
     SgAsmInstruction *disassembleOne(const unsigned char *buf, rose_addr_t buf_va, size_t buf_size, rose_addr_t start_va,
                                      AddressSet *successors=NULL);
 
+    /** Decode one instruction into a compact record.
+     *
+     *  This is like @ref disassembleOne except the result is a fixed-size @ref DecodedInstruction record instead of an AST, and
+     *  no AST is retained. It is intended for linear sweeps and other scans that look at large numbers of instructions but only
+     *  need a few facts about each, and would otherwise accumulate (or leak) an AST for every address they visit. Bytes that
+     *  cannot be decoded produce a record whose @c isUnknown is set, the same as @ref makeUnknownInstruction. The return value
+     *  is false, and the record is cleared, if there is no executable memory at the specified address.
+     *
+     *  The base implementation obtains the record from a temporary AST that is deleted before returning, which returns the
+     *  nodes to the memory pools to be reused by the next decode. Subclasses may override this with a decoder that doesn't
+     *  build an AST at all.
+     *
+     *  Thread safety: The safety of this method is the same as for @ref disassembleOne. */
+    virtual bool decodeOne(const MemoryMap::Ptr &map, rose_addr_t start_va, DecodedInstruction &record /*out*/);
+
+    /** Build the AST for a previously decoded instruction.
+     *
+     *  Returns a new instruction AST for the instruction described by @p record by disassembling it again from the specified
+     *  memory map, which must contain the same bytes that were decoded.
+     *
+     *  Thread safety: The safety of this method is the same as for @ref disassembleOne. */
+    SgAsmInstruction* materialize(const MemoryMap::Ptr &map, const DecodedInstruction &record);
+
 
     /***************************************************************************************************************************
      *                                          Miscellaneous methods
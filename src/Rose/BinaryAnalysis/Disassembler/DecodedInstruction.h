@@ -0,0 +1,91 @@
+#ifndef ROSE_BinaryAnalysis_Disassembler_DecodedInstruction_H
+#define ROSE_BinaryAnalysis_Disassembler_DecodedInstruction_H
+#include <featureTests.h>
+#ifdef ROSE_ENABLE_BINARY_ANALYSIS
+
+#include <Rose/BinaryAnalysis/BasicTypes.h>
+#include <Rose/BinaryAnalysis/RegisterDescriptor.h>
+
+#include <cstdint>
+#include <string>
+
+class SgAsmExpression;
+class SgAsmInstruction;
+
+namespace Rose {
+namespace BinaryAnalysis {
+namespace Disassembler {
+
+/** Compact, fixed-size description of one decoded instruction.
+ *
+ *  This record is filled in by @ref Base::decodeOne and is an alternative to the AST returned by @ref Base::disassembleOne for
+ *  analyses that only need a few facts about each instruction, such as linear sweeps that count mnemonics or measure
+ *  instruction sizes. The record contains no pointers and owns no heap memory, so a single record can be reused for every
+ *  instruction of a sweep. When the full AST is needed for some instruction, it can be obtained from @ref Base::materialize.
+ *
+ *  Operands are summarized by kind. Register operands store the register descriptor; immediate operands store the value;
+ *  memory operands store the base and index registers, the scale and the constant displacement of the address expression
+ *  when the address has the usual base + index * scale + displacement form. Operands that don't fit into one of these
+ *  categories (e.g., floating-point constants or register lists) have kind @c OTHER. Instructions with more than @ref
+ *  maxOperands operands have only their first operands described, and mnemonics longer than @ref maxMnemonicSize are
+ *  truncated. */
+struct DecodedInstruction {
+    /** Maximum number of instruction bytes stored in the record. */
+    static constexpr size_t maxBytes = 16;
+
+    /** Maximum number of operands described by the record. */
+    static constexpr size_t maxOperands = 6;
+
+    /** Maximum number of characters stored for the mnemonic, not counting the NUL terminator. */
+    static constexpr size_t maxMnemonicSize = 31;
+
+    /** Kind of operand. */
+    enum class OperandKind: uint8_t {
+        NONE,                                           /**< Operand slot is not used. */
+        REGISTER,                                       /**< Register operand. */
+        IMMEDIATE,                                      /**< Integer constant. */
+        MEMORY,                                         /**< Memory reference. */
+        OTHER                                           /**< Any other kind of operand expression. */
+    };
+
+    /** Summary of one operand. */
+    struct Operand {
+        OperandKind kind = OperandKind::NONE;           /**< Kind of operand. */
+        uint16_t nBits = 0;                             /**< Width of the register, constant, or memory access. */
+        RegisterDescriptor reg;                         /**< Register, or base register of a memory address. */
+        RegisterDescriptor indexReg;                    /**< Index register of a memory address. */
+        uint64_t value = 0;                             /**< Immediate value, or displacement of a memory address. */
+        uint64_t scale = 0;                             /**< Scale factor applied to the index register. */
+    };
+
+    rose_addr_t address = 0;                            /**< Starting address of the instruction. */
+    unsigned kind = 0;                                  /**< Architecture-specific kind, as returned by @c get_anyKind. */
+    size_t size = 0;                                    /**< Size of the instruction in bytes (possibly more than maxBytes). */
+    size_t nOperands = 0;                               /**< Number of operands described in @ref operands. */
+    bool isUnknown = false;                             /**< True if the bytes could not be decoded as an instruction. */
+    char mnemonic[maxMnemonicSize + 1] = {};            /**< NUL-terminated, possibly truncated mnemonic. */
+    uint8_t bytes[maxBytes] = {};                       /**< First bytes of the instruction encoding. */
+    Operand operands[maxOperands];                      /**< Operand summaries. */
+
+    /** Reset the record to its default-constructed state. */
+    void clear();
+
+    /** Mnemonic as a string. */
+    std::string mnemonicString() const;
+
+    /** Fill in this record from an instruction AST.
+     *
+     *  This is used by the decoders that don't have a specialized implementation of @ref Base::decodeOne. The AST is not
+     *  modified and no pointers into it are retained. */
+    void fromAst(SgAsmInstruction*);
+
+private:
+    static void describeOperand(SgAsmExpression*, Operand&);
+};
+
+} // namespace
+} // namespace
+} // namespace
+
+#endif
+#endif
@@ -123,12 +123,22 @@ public:
 
     virtual SgAsmInstruction *makeUnknownInstruction(const Exception&) override;
 
+    /** Decode one instruction into a compact record.
+     *
+     *  The common general purpose instructions are decoded directly from their bytes without building an AST. All others are
+     *  decoded by the base class implementation. Either way the record is the same as what @ref DecodedInstruction::fromAst
+     *  produces from the AST returned by @ref disassembleOne. */
+    virtual bool decodeOne(const MemoryMap::Ptr &map, rose_addr_t start_va, DecodedInstruction &record /*out*/) override;
+
 
     /*========================================================================================================================
      * Data types
      *========================================================================================================================*/
 private:
 
+    /** Decoder for the instructions that @ref decodeOne handles without an AST. */
+    class FastDecoder;
+
     /** Same as Exception except with a different constructor for ease of use in X86.  This
      *  constructor should be used when an exception occurs during disassembly of an instruction; it is not suitable for
      *  errors that occur before or after (use superclass constructors for that case). */
@@ -0,0 +1,177 @@
+#ifndef ROSE_BinaryAnalysis_DwarfIndex_H
+#define ROSE_BinaryAnalysis_DwarfIndex_H
+#include <featureTests.h>
+#ifdef ROSE_ENABLE_BINARY_ANALYSIS
+
+#include <Rose/BinaryAnalysis/BasicTypes.h>
+#include <Rose/Exception.h>
+#include <Rose/SourceLocation.h>
+#include <ByteOrder.h>
+
+#include <Sawyer/Optional.h>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+class SgAsmGenericFile;
+class SgAsmGenericSection;
+
+namespace Rose {
+namespace BinaryAnalysis {
+
+/** Indexed access to DWARF debugging information.
+ *
+ *  The DWARF frontend (@c readDwarf) converts every debugging information entry and every line table row of a file into
+ *  @c SgAsmDwarf* IR nodes, which is expensive for large specimens when only the mapping between addresses and source lines is
+ *  needed. This class instead reads the ".debug_line" and ".debug_info" sections directly from the file's bytes and doesn't
+ *  depend on libdwarf.
+ *
+ *  Constructing an index only scans the unit headers of these sections. The line number program of each unit is decoded
+ *  the first time it's needed, either one at a time with @ref lineTable or all at once in parallel with @ref
+ *  decodeLineTables. The decoded rows are stored in compact fixed-size records, and all rows of all units are merged into
+ *  one table sorted by address for fast address-to-source lookups.
+ *
+ *  The compilation units of ".debug_info" are indexed by their section offsets so that the unit containing any debugging
+ *  information entry can be found from the entry's offset. Only the first entry of each unit is decoded, for the unit's
+ *  compilation directory and line table, which older DWARF versions don't record in the line table itself.
+ *
+ *  Objects of this class are not thread safe, although @ref decodeLineTables uses multiple threads internally. */
+class DwarfIndex {
+public:
+    /** Exceptions for malformed debugging information. */
+    class Exception: public Rose::Exception {
+    public:
+        /** Construct an exception with an error message. */
+        explicit Exception(const std::string &s): Rose::Exception(s) {}
+        ~Exception() throw() {}
+    };
+
+    /** Header of one compilation unit in the ".debug_info" section. */
+    struct Unit {
+        rose_addr_t offset = 0;                         /**< Section offset of the unit header. */
+        rose_addr_t size = 0;                           /**< Size of the unit in bytes, including its header. */
+        rose_addr_t firstEntry = 0;                     /**< Section offset of the unit's first debugging information entry. */
+        rose_addr_t abbrevOffset = 0;                   /**< Offset of the unit's abbreviations in ".debug_abbrev". */
+        unsigned version = 0;                           /**< DWARF version number. */
+        unsigned unitType = 1;                          /**< DWARF-5 unit type. Earlier versions only have compile units (1). */
+        unsigned addressSize = 0;                       /**< Size of target addresses in bytes. */
+        bool is64 = false;                              /**< Whether the unit uses the 64-bit DWARF format. */
+        uint64_t dwoId = 0;                             /**< Split object identifier of DWARF-5 skeleton and split units. */
+        uint64_t typeSignature = 0;                     /**< Signature of the type described by a DWARF-5 type unit. */
+        rose_addr_t typeOffset = 0;                     /**< Offset of the type's entry relative to a DWARF-5 type unit. */
+        std::string compilationDir;                     /**< Value of the unit entry's DW_AT_comp_dir, if any. */
+        Sawyer::Optional<rose_addr_t> lineTableOffset;  /**< Value of the unit entry's DW_AT_stmt_list, if any. */
+    };
+
+    /** One row of a line table.
+     *
+     *  In the rows of a @ref LineTable, the @ref file member is an index into that table's @ref LineTable::files. In the merged
+     *  table returned by @ref addressTable, it's an index into @ref fileNames. */
+    struct LineRow {
+        rose_addr_t va = 0;                             /**< Instruction address. */
+        uint32_t file = 0;                              /**< File name index. */
+        uint32_t line = 0;                              /**< Line number, or zero if unknown. */
+        uint32_t column = 0;                            /**< Column number, or zero if unknown. */
+        bool endSequence = false;                       /**< Row marks the first address past the end of a sequence. */
+    };
+
+    /** Decoded line number program of one unit in the ".debug_line" section. */
+    struct LineTable {
+        rose_addr_t offset = 0;                         /**< Section offset of the line table header. */
+        rose_addr_t size = 0;                           /**< Size of the line table in bytes, including its header. */
+        unsigned version = 0;                           /**< DWARF version number. */
+        std::string compilationDir;                     /**< Compilation directory from the unit that refers to the table. */
+        bool isDecoded = false;                         /**< Whether the program has been decoded into rows. */
+        std::string error;                              /**< Non-empty if the program could not be decoded. */
+        std::vector<std::string> files;                 /**< File names referenced by the rows. */
+        std::vector<LineRow> rows;                      /**< Rows in the order they were produced by the program. */
+    };
+
+private:
+    // Contents of a section, pointing into the file's data.
+    struct SectionData {
+        const uint8_t *data = nullptr;
+        size_t size = 0;
+    };
+
+    ByteOrder::Endianness sex_ = ByteOrder::ORDER_LSB;
+    SectionData debugInfo_, debugAbbrev_, debugLine_, debugStr_, debugLineStr_;
+    std::vector<Unit> units_;                           // sorted by offset
+    std::vector<LineTable> lineTables_;                 // sorted by offset
+    bool addressTableBuilt_ = false;
+    std::vector<std::string> fileNames_;                // files referenced by addressTable_
+    std::vector<LineRow> addressTable_;                 // all rows of all line tables, sorted by address
+
+public:
+    /** Construct an empty index. */
+    DwarfIndex() {}
+
+    /** Construct an index for a file.
+     *
+     *  The unit headers of the file's ".debug_info" and ".debug_line" sections are scanned, but no line number programs are
+     *  decoded. If the file has no DWARF sections then the index is empty. Throws an @ref Exception if a unit header is
+     *  malformed. */
+    explicit DwarfIndex(SgAsmGenericFile*);
+
+    /** True if the index has no compilation units and no line tables. */
+    bool isEmpty() const {
+        return units_.empty() && lineTables_.empty();
+    }
+
+    /** Compilation units sorted by section offset. */
+    const std::vector<Unit>& units() const {
+        return units_;
+    }
+
+    /** Compilation unit that contains the specified ".debug_info" offset.
+     *
+     *  Returns nothing if the offset is not inside any unit. */
+    Sawyer::Optional<Unit> unitContaining(rose_addr_t offset) const;
+
+    /** Number of line tables. */
+    size_t nLineTables() const {
+        return lineTables_.size();
+    }
+
+    /** Line table by index.
+     *
+     *  The table's line number program is decoded the first time the table is requested. If the program is malformed then
+     *  the returned table has a non-empty @ref LineTable::error and the rows that were decoded before the error. */
+    const LineTable& lineTable(size_t idx);
+
+    /** Decode all line tables.
+     *
+     *  Line tables that have not been decoded yet are decoded in parallel using the specified number of threads. A value of
+     *  zero means use the number of threads specified by the global "--threads" command-line switch. */
+    void decodeLineTables(size_t nThreads = 0);
+
+    /** All line table rows sorted by address.
+     *
+     *  This decodes all line tables if necessary. Rows having the same address are kept in the order they appear in the
+     *  section, except end-of-sequence rows are placed before the other rows at the same address. The @ref LineRow::file
+     *  members are indices into @ref fileNames. */
+    const std::vector<LineRow>& addressTable();
+
+    /** File names referenced by @ref addressTable. */
+    const std::vector<std::string>& fileNames();
+
+    /** Source location for an address.
+     *
+     *  Returns the location of the last row whose address is less than or equal to the specified address and which is in the
+     *  same sequence, or an empty location if there is no such row. Column numbers are not included in the location. */
+    SourceLocation sourceLocation(rose_addr_t va);
+
+private:
+    void indexUnits();
+    void readUnitEntry(Unit&, size_t end) const;
+    void indexLineTables();
+    void buildAddressTable();
+    static SectionData sectionData(SgAsmGenericSection*);
+    void decodeLineTable(LineTable&) const;
+};
+
+} // namespace
+} // namespace
+
+#endif
+#endif
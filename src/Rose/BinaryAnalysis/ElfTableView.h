@@ -0,0 +1,179 @@
+#ifndef ROSE_BinaryAnalysis_ElfTableView_H
+#define ROSE_BinaryAnalysis_ElfTableView_H
+#include <featureTests.h>
+#ifdef ROSE_ENABLE_BINARY_ANALYSIS
+
+#include <Rose/BinaryAnalysis/BasicTypes.h>
+#include <ByteOrder.h>
+
+#include <Sawyer/Optional.h>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+class SgAsmElfRelocSection;
+class SgAsmElfStringSection;
+class SgAsmElfSymbol;
+class SgAsmElfSymbolSection;
+
+namespace Rose {
+namespace BinaryAnalysis {
+
+/** Read-only view of an ELF symbol table.
+ *
+ *  The ELF parser creates one @ref SgAsmElfSymbol node per symbol table entry, which is expensive for large dynamic symbol
+ *  tables when an analysis needs only a few of the symbols. This view instead decodes entries directly from the bytes of
+ *  the section each time they're requested, and reads symbol names from the linked string table. Entries are identified by
+ *  their index in the table, which is the same index used by relocation entries and by the section's symbol list.
+ *
+ *  Name lookups use a hash index from name to entry indices that's built from the file bytes the first time it's needed.
+ *
+ *  Since the view reads the file bytes, it reflects the table as it was in the file, not any later modifications to the
+ *  section's @ref SgAsmElfSymbol nodes. */
+class ElfSymbolTableView {
+public:
+    /** One decoded symbol table entry. */
+    struct Entry {
+        size_t index = 0;                               /**< Index of this entry in the symbol table. */
+        rose_addr_t nameOffset = 0;                     /**< Offset of the name in the linked string table. */
+        rose_addr_t value = 0;                          /**< Symbol value, usually an address. */
+        rose_addr_t size = 0;                           /**< Size of the object associated with the symbol. */
+        unsigned info = 0;                              /**< Binding and type, as stored in the file. */
+        unsigned other = 0;                             /**< Visibility, as stored in the file. */
+        unsigned shndx = 0;                             /**< Index of the section to which the symbol is bound. */
+
+        /** Symbol binding from the @ref info field. */
+        unsigned binding() const { return info >> 4; }
+
+        /** Symbol type from the @ref info field. */
+        unsigned type() const { return info & 0xf; }
+    };
+
+private:
+    SgAsmElfSymbolSection *section_ = nullptr;
+    SgAsmElfStringSection *strings_ = nullptr;
+    ByteOrder::Endianness sex_ = ByteOrder::ORDER_UNSPECIFIED;
+    size_t wordSize_ = 0;
+    size_t entrySize_ = 0;
+    size_t nEntries_ = 0;
+    bool nameIndexBuilt_ = false;
+    std::unordered_map<std::string, std::vector<size_t>> nameIndex_;
+
+public:
+    /** Construct a view of the specified symbol table.
+     *
+     *  The section must not be null and must have been created by the ELF parser. No entries are decoded by the
+     *  constructor. */
+    explicit ElfSymbolTableView(SgAsmElfSymbolSection*);
+
+    /** Section being viewed. */
+    SgAsmElfSymbolSection* section() const {
+        return section_;
+    }
+
+    /** Number of entries in the symbol table.
+     *
+     *  This is the table size divided by the entry size from the section table entry, independent of how many IR nodes the
+     *  parser created. */
+    size_t size() const {
+        return nEntries_;
+    }
+
+    /** Decode one entry.
+     *
+     *  The index must be less than @ref size. */
+    Entry entry(size_t idx) const;
+
+    /** Name of a symbol.
+     *
+     *  Returns the empty string if the entry has no name.
+     *
+     * @{ */
+    std::string name(size_t idx) const;
+    std::string name(const Entry&) const;
+    /** @} */
+
+    /** Indices of all entries with the specified name.
+     *
+     *  The first call builds the name index for the whole table. The returned indices are in increasing order. */
+    const std::vector<size_t>& findByName(const std::string&);
+
+    /** Symbol node for an entry, if the parser created one.
+     *
+     *  Returns the symbol at the specified index of the section's symbol list, or null if the list doesn't have that many
+     *  entries. */
+    SgAsmElfSymbol* symbol(size_t idx) const;
+
+private:
+    void buildNameIndex();
+};
+
+/** Read-only view of an ELF relocation table.
+ *
+ *  Like @ref ElfSymbolTableView, this decodes relocation entries directly from the bytes of the section when they're
+ *  requested rather than from @ref SgAsmElfRelocEntry nodes. Lookups by relocation offset use a hash index that's built the
+ *  first time it's needed. */
+class ElfRelocTableView {
+public:
+    /** One decoded relocation entry. */
+    struct Entry {
+        size_t index = 0;                               /**< Index of this entry in the relocation table. */
+        rose_addr_t offset = 0;                         /**< Address or offset being relocated. */
+        rose_addr_t addend = 0;                         /**< Addend, or zero if the table has no addends. */
+        size_t symbolIndex = 0;                         /**< Index into the linked symbol table. */
+        unsigned type = 0;                              /**< Relocation type. */
+    };
+
+private:
+    SgAsmElfRelocSection *section_ = nullptr;
+    ByteOrder::Endianness sex_ = ByteOrder::ORDER_UNSPECIFIED;
+    size_t wordSize_ = 0;
+    size_t entrySize_ = 0;
+    size_t nEntries_ = 0;
+    bool usesAddend_ = false;
+    bool offsetIndexBuilt_ = false;
+    std::unordered_map<rose_addr_t, size_t> offsetIndex_;
+
+public:
+    /** Construct a view of the specified relocation table.
+     *
+     *  The section must not be null and must have been created by the ELF parser. No entries are decoded by the
+     *  constructor. */
+    explicit ElfRelocTableView(SgAsmElfRelocSection*);
+
+    /** Section being viewed. */
+    SgAsmElfRelocSection* section() const {
+        return section_;
+    }
+
+    /** Symbol table linked to the relocation table, or null. */
+    SgAsmElfSymbolSection* symbolSection() const;
+
+    /** Number of entries in the relocation table.
+     *
+     *  This is the table size divided by the entry size from the section table entry, independent of how many IR nodes the
+     *  parser created. */
+    size_t size() const {
+        return nEntries_;
+    }
+
+    /** Decode one entry.
+     *
+     *  The index must be less than @ref size. */
+    Entry entry(size_t idx) const;
+
+    /** Find the entry that relocates the specified offset.
+     *
+     *  If more than one entry has the same offset then the one with the lowest index is returned. The first call builds the
+     *  offset index for the whole table. */
+    Sawyer::Optional<Entry> findByOffset(rose_addr_t);
+
+private:
+    void buildOffsetIndex();
+};
+
+} // namespace
+} // namespace
+
+#endif
+#endif
@@ -13,6 +13,8 @@
 #include <Sawyer/Message.h>
 #include <boost/filesystem/path.hpp>
 #include <boost/logic/tribool.hpp>
+#include <atomic>
+#include <memory>
 
 namespace Rose {
 namespace BinaryAnalysis {
@@ -104,6 +106,7 @@ public:
         Sawyer::Optional<boost::chrono::duration<double> > smtTimeout; /**< Max seconds allowed per SMT solve call. */
         size_t maxExprSize;                             /**< Maximum symbolic expression size before replacement. */
         bool traceSemantics;                            /**< Trace all instruction semantics operations. */
+        size_t nThreads;                                /**< Threads for searching from multiple starting vertices. */
 
         // Null dereferences
         struct NullDeref {
@@ -124,7 +127,7 @@ public:
               maxRecursionDepth((size_t)-1), nonAddressIsFeasible(true), solverName("best"),
               memoryParadigm(LIST_BASED_MEMORY), processFinalVertex(false), ignoreSemanticFailure(false),
               kCycleCoefficient(0.0), edgeVisitOrder(VISIT_NATURAL), trackingCodeCoverage(true), maxExprSize(UNLIMITED),
-              traceSemantics(false) {}
+              traceSemantics(false), nThreads(1) {}
     };
 
     /** Statistics from path searching. */
@@ -349,10 +352,14 @@ private:
     Partitioner2::CfgConstVertexSet pathsBeginVertices_;// vertices of paths_ where searching starts
     Partitioner2::CfgConstVertexSet pathsEndVertices_;  // vertices of paths_ where searching stops
     bool isDirectedSearch_ = true;                      // use pathsEndVertices_?
+    Partitioner2::CfgConstVertexSet cfgBeginVertices_;  // CFG vertices where searching starts
+    Partitioner2::CfgConstVertexSet cfgEndVertices_;    // CFG vertices where directed searching stops
+    Partitioner2::CfgConstVertexSet cfgAvoidVertices_;  // CFG vertices to avoid
     Partitioner2::CfgConstEdgeSet cfgAvoidEdges_;       // CFG edges to avoid
     Partitioner2::CfgConstVertexSet cfgEndAvoidVertices_;// CFG end-of-path and other avoidance vertices
     FunctionSummarizer::Ptr functionSummarizer_;        // user-defined function for handling function summaries
     InstructionSemantics::BaseSemantics::StatePtr initialState_; // set by setInitialState.
+    const std::atomic<bool> *cancelSearch_ = nullptr;   // if set and true, depthFirstSearch returns early
     static Sawyer::Attribute::Id POST_STATE;            // stores semantic state after executing the insns for a vertex
     static Sawyer::Attribute::Id POST_INSN_LENGTH;      // path length in instructions at end of vertex
     static Sawyer::Attribute::Id EFFECTIVE_K;           // (double) effective maximimum path length
@@ -481,6 +488,15 @@ public:
     void functionSummarizer(const FunctionSummarizer::Ptr &f) { functionSummarizer_ = f; }
     /** @} */
 
+    /** Create an analyzer for one thread of a parallel search.
+     *
+     *  When @ref Settings::nThreads allows @ref depthFirstSearch to run in parallel, each starting vertex is searched by its
+     *  own analyzer created by this function. The caller copies this analyzer's settings and function summaries to the new
+     *  analyzer, gives it this analyzer's function summarizer wrapped so that its callbacks are invoked one thread at a time,
+     *  and sets its search boundary. The default implementation returns a new @ref FeasiblePath, so subclasses that
+     *  override other processing functions should also override this function to return an instance of the subclass. */
+    virtual std::unique_ptr<FeasiblePath> createWorker() const;
+
     ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     //                                  Utilities
     ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -575,7 +591,17 @@ public:
     /** Find all feasible paths.
      *
      *  Searches for paths and calls the @p pathProcessor each time a feasible path is found. The space is explored using a
-     *  depth first search, and the search can be limited with various @ref settings. */
+     *  depth first search, and the search can be limited with various @ref settings.
+     *
+     *  If there is more than one starting vertex and @ref Settings::nThreads is not one, then the starting vertices are
+     *  searched concurrently, each by its own analyzer (see @ref createWorker) with its own SMT solver and semantic state. The
+     *  feasible paths and null dereferences found by each analyzer are saved and reported to the @p pathProcessor from the
+     *  calling thread in the order of the starting vertices, so the results are the same regardless of the number of threads.
+     *  When called this way, the @c analyzer argument of the callbacks is the worker analyzer, the @c solver argument is a new
+     *  solver holding the assertions that were present when the result was found, and the action returned by @c nullDeref has
+     *  no effect on the search. If @c found returns @c BREAK then no further results are reported and the remaining searches
+     *  are abandoned. The @c memoryIo callback and the @ref functionSummarizer callbacks are invoked by the worker threads as
+     *  needed, one at a time but in no particular order. */
     void depthFirstSearch(PathProcessor &pathProcessor);
 
 
@@ -646,6 +672,9 @@ private:
     // Check that analysis settings are valid, or throw an exception.
     void checkSettings() const;
 
+    // Search from each starting vertex in a separate worker analyzer and report the results in order of starting vertex.
+    void parallelDepthFirstSearch(PathProcessor&, size_t nThreads);
+
     static rose_addr_t virtualAddress(const Partitioner2::ControlFlowGraph::ConstVertexIterator &vertex);
 
     void insertCallSummary(const Partitioner2::ControlFlowGraph::ConstVertexIterator &pathsCallSite,
@@ -184,7 +184,12 @@ typedef boost::shared_ptr<class MemoryState> MemoryStatePtr;
 /** Byte-addressable memory.
  *
  *  This class represents an entire state of memory via MemoryMap, allocating new memory in units of pages (the size of a page
- *  is configurable. */
+ *  is configurable.
+ *
+ *  Copying a memory state shares the data buffers between the copies and marks them as copy-on-write. The first write to a
+ *  shared buffer by either copy gives that copy its own private buffer for only the page being written, so forking a state
+ *  that has a large memory image costs time proportional to the number of segments and pages later written, not the size of
+ *  the image. The pages written since the state was created are tracked so that they can be enumerated cheaply. */
 class MemoryState: public BaseSemantics::MemoryState {
 public:
     /** Base type. */
@@ -196,6 +201,7 @@ public:
 private:
     MemoryMap::Ptr map_;
     rose_addr_t pageSize_;
+    AddressIntervalSet dirtyPages_;                     // pages written since this state was created or last cleaned
 
     ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     // Real constructors
@@ -227,8 +233,9 @@ public:
 
     /** Instantiates a new deep copy of an existing state.
      *
-     *  For efficiency purposes, the data buffers are not copied immediately but rather marked as copy-on-write. However, the
-     *  newly constructed memory map will have its own segments, which hold the segment names, access permissions, etc. */
+     *  For efficiency purposes, the data buffers are not copied immediately but rather marked as copy-on-write, and are later
+     *  copied one page at a time as pages are written. However, the newly constructed memory map will have its own segments,
+     *  which hold the segment names, access permissions, etc. The new state has no dirty pages. */
     static MemoryStatePtr instance(const MemoryStatePtr &other) {
         return MemoryStatePtr(new MemoryState(*other));
     }
@@ -248,8 +255,9 @@ public:
     /** Virtual copy constructor.
      *
      *  Creates a new deep copy of this memory state. For efficiency purposes, the data buffers are not copied immediately but
-     *  rather marked as copy-on-write.  However, the newly constructed memory map will have its own segments, which hold the
-     *  segment names, access permissions, etc. */
+     *  rather marked as copy-on-write, and are later copied one page at a time as pages are written.  However, the newly
+     *  constructed memory map will have its own segments, which hold the segment names, access permissions, etc. The new state
+     *  has no dirty pages. */
     virtual BaseSemantics::MemoryStatePtr clone() const override {
         return MemoryStatePtr(new MemoryState(*this));
     }
@@ -270,6 +278,7 @@ public:
 public:
     virtual void clear() override {
         map_ = MemoryMap::Ptr();
+        dirtyPages_.clear();
     }
 
     virtual void hash(Combinatorics::Hasher&, BaseSemantics::RiscOperators *addrOps,
@@ -327,6 +336,35 @@ public:
      *  is already allocated unless: it will replace the allocated page with a new one containing all zeros. */
     void allocatePage(rose_addr_t va);
 
+    /** Pages that have been written.
+     *
+     *  Returns the addresses of all pages that were allocated or written since this state was created, copied, or last had its
+     *  dirty pages cleared. Each page is aligned on a page boundary and has the page size. Comparing only these pages is
+     *  enough to find the differences between a state and the state from which it was copied. */
+    const AddressIntervalSet& dirtyPages() const { return dirtyPages_; }
+
+    /** Forget which pages have been written. */
+    void clearDirtyPages() { dirtyPages_.clear(); }
+
+    /** Read bytes without creating semantic values.
+     *
+     *  Reads @p nBytes bytes starting at @p va into @p buffer. Bytes that are not mapped are read as zero. If @p
+     *  allowSideEffects is set then pages are allocated for unmapped bytes the same way as @ref readMemory does, otherwise the
+     *  state is not modified. */
+    void readBytes(rose_addr_t va, uint8_t *buffer, size_t nBytes, bool allowSideEffects);
+
+    /** Write bytes without creating semantic values.
+     *
+     *  Writes @p nBytes bytes from @p buffer starting at @p va, allocating pages as necessary, the same as @ref writeMemory. */
+    void writeBytes(rose_addr_t va, const uint8_t *buffer, size_t nBytes);
+
+protected:
+    // If the page containing the specified address is backed by a copy-on-write buffer, then replace that page with a private
+    // copy so a subsequent write doesn't copy the entire buffer.
+    void unsharePage(rose_addr_t va);
+
+    // Mark the page containing the specified address as dirty.
+    void markDirty(rose_addr_t va);
 };
 
 
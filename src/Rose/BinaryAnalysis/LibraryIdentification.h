@@ -346,6 +346,22 @@ public:
     /** Find database functions that match a given function. */
     std::vector<Function::Ptr> search(const Partitioner2::PartitionerConstPtr &partitioner, const Partitioner2::FunctionPtr&);
 
+    /** Database functions that match each specimen function, indexed by the specimen function's entry address. */
+    using Matches = Sawyer::Container::Map<rose_addr_t, std::vector<Function::Ptr>>;
+
+    /** Find database functions that match many functions.
+     *
+     *  This returns the same matches as calling @ref search once per function, but is much faster for large specimens. The
+     *  specimen functions are hashed in parallel using the specified number of threads (zero means use the number of threads
+     *  specified by the global "--threads" command-line switch), and then the database function table is read with a single
+     *  query and each row is looked up in an in-memory table of the specimen hashes. Specimen functions that have no matches are
+     *  not present in the return value. If no list of functions is given, then all the partitioner's functions are matched.
+     *
+     * @{ */
+    Matches search(const Partitioner2::PartitionerConstPtr&, const std::vector<Partitioner2::FunctionPtr>&, size_t nThreads = 0);
+    Matches search(const Partitioner2::PartitionerConstPtr&, size_t nThreads = 0);
+    /** @} */
+
     ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     // Utilities
     ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
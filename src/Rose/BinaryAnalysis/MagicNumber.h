@@ -66,6 +66,13 @@ public:
     /** Identify the magic number at the specified address. */
     std::string identify(const MemoryMap::Ptr&, rose_addr_t va) const;
 
+    /** Identify the magic number at the start of a buffer.
+     *
+     *  This is the same as identifying the magic number at an address whose memory contains the specified bytes, except the
+     *  caller has already read the bytes. This is useful when scanning many nearby addresses since the memory can be read
+     *  once in a large block. At most @ref maxBytesToCheck bytes of the buffer are used. */
+    std::string identify(const uint8_t *buf, size_t nBytes) const;
+
 private:
     void init();
 };
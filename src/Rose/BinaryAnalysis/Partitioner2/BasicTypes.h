@@ -291,6 +291,13 @@ struct LoaderSettings {
      *  libraries). These substitutions are escaped using Bourne shell syntax and thus should not be quoted. */
     std::string linker = "ld -o %o --unresolved-symbols=ignore-all --whole-archive %f";
 
+    /** Whether to import DWARF debugging information into the AST.
+     *
+     *  If set and ROSE was configured with libdwarf, then the DWARF information of each parsed container is converted to
+     *  @c SgAsmDwarf* IR nodes. Mapping addresses to source locations doesn't need these nodes: containers that have no
+     *  imported DWARF information get their source locations from a @ref DwarfIndex, which reads only the line tables. */
+    bool importDwarf = true;
+
     /** Names to erase from the environment.
      *
      *  This property is a list of environment variable names that will be removed before launching a "run:" style specimen.
@@ -334,6 +341,8 @@ private:
                     envErasePatterns.push_back(boost::regex(reStr));
             }
         }
+        if (version >= 2)
+            s & BOOST_SERIALIZATION_NVP(importDwarf);
     }
 };
 
@@ -871,7 +880,7 @@ using ThunkPredicatesPtr = Sawyer::SharedPointer<ThunkPredicates>; /**< Shared-o
 // Class versions must be at global scope
 BOOST_CLASS_VERSION(Rose::BinaryAnalysis::Partitioner2::PartitionerSettings, 8);
 BOOST_CLASS_VERSION(Rose::BinaryAnalysis::Partitioner2::BasePartitionerSettings, 1);
-BOOST_CLASS_VERSION(Rose::BinaryAnalysis::Partitioner2::LoaderSettings, 1);
+BOOST_CLASS_VERSION(Rose::BinaryAnalysis::Partitioner2::LoaderSettings, 2);
 BOOST_CLASS_VERSION(Rose::BinaryAnalysis::Partitioner2::DisassemblerSettings, 1);
 
 #endif
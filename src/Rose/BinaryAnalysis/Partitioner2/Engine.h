@@ -437,6 +437,20 @@ public:
      *  partition function also understands how to open RBA files. */
     virtual PartitionerPtr loadPartitioner(const boost::filesystem::path&, SerialIo::Format = SerialIo::BINARY);
 
+    /** Load function summaries from a file.
+     *
+     *  Reads only the function table section of the specified RBA file, which is much faster than loading the whole
+     *  partitioner when only a list of functions is needed. Files written by older versions of ROSE have no such section, in
+     *  which case the partitioner is loaded and summarized instead. */
+    virtual SerialIo::FunctionTable loadFunctionTable(const boost::filesystem::path&, SerialIo::Format = SerialIo::BINARY);
+
+    /** Load a memory map from a file.
+     *
+     *  Reads only the memory map section of the specified RBA file, which is much faster than loading the whole partitioner
+     *  when only the memory map is needed. Files written by older versions of ROSE have no such section, in which case the
+     *  partitioner is loaded and its memory map is returned. */
+    virtual MemoryMapPtr loadMemoryMap(const boost::filesystem::path&, SerialIo::Format = SerialIo::BINARY);
+
     ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     //                                  Command-line parsing
     //
@@ -88,6 +88,16 @@ public:
     /* Mapping from functions to sets of CFG vertex IDs. */
     typedef Sawyer::Container::Map<Partitioner2::FunctionPtr, std::set<size_t/*vertexId*/> > FunctionToVertexMap;
 
+private:
+    // Snapshot of the CFG successors in compressed sparse row form. The successors of vertex i are targets[begin[i]] up to but
+    // not including targets[begin[i+1]].
+    struct Successors {
+        std::vector<size_t> begin;
+        std::vector<size_t> targets;
+
+        explicit Successors(const Partitioner2::ControlFlowGraph&);
+    };
+
 public:
     /** Facility for emitting diagnostics. */
     static Diagnostics::Facility mlog;
@@ -355,7 +365,12 @@ public:
      *
      *  This function calls runs a @ref propagate step and a marking step in a loop until a steady state is reached. The
      *  marking step looks for new basic blocks that can be marked as intrinsically reachable based on the newly reachable
-     *  blocks from the previous propagate step. */
+     *  blocks from the previous propagate step.
+     *
+     *  The CFG is copied once into a compact successor table that's used by all propagate steps. When a marking step only
+     *  adds reasons, the following propagate step starts from the newly marked vertices instead of recomputing the
+     *  reachability of the whole graph. The instructions of the newly reachable blocks are scanned in parallel according to
+     *  @ref Settings::nThreads. */
     void iterate(const Partitioner2::PartitionerConstPtr &partitioner);
 
     /** Find all CFG vertices mentioned explicitly in a basic block.
@@ -386,6 +401,11 @@ private:
     // Implementation of the "propagate" functions
     size_t propagateImpl(const Partitioner2::PartitionerConstPtr&, std::vector<size_t>*);
 
+    // Propagate reachability over the successor table. If "from" is null then reachability is recomputed from the intrinsic
+    // reachability of all vertices, otherwise reachability is only propagated from the specified vertices after adding their
+    // intrinsic reachability. Vertices whose reachability changes are appended to the optional vector.
+    size_t propagateImpl(const Successors&, const std::vector<size_t> *from, std::vector<size_t>*);
+
     // Resize vectors based on partitioner CFG size
     void resize(const Partitioner2::PartitionerConstPtr&);
 
@@ -395,6 +415,9 @@ private:
 
     // Do the marking part of the "iterate" function.
     size_t iterationMarking(const Partitioner2::PartitionerConstPtr&, const std::vector<size_t> &vertexIds);
+
+    // Number of threads to use for parallel parts of the analysis.
+    size_t nThreads() const;
 };
 
 } // namespace
@@ -37,6 +37,7 @@
 #include <boost/iostreams/stream.hpp>
 #endif
 
+#include <Rose/BinaryAnalysis/BasicTypes.h>
 #include <Rose/Progress.h>
 #include <Rose/Exception.h>
 #include <boost/filesystem.hpp>
@@ -45,6 +46,8 @@
 #include <Sawyer/Message.h>
 #include <Sawyer/ProgressBar.h>
 #include <Sawyer/Synchronization.h>
+#include <string>
+#include <vector>
 
 namespace Rose {
 namespace BinaryAnalysis {
@@ -66,6 +69,12 @@ namespace BinaryAnalysis {
  *  As objects are written to the output stream, they are each preceded by a object type identifier. These integer type
  *  identifiers are available when reading from the stream in order to decide which type of object to read next.
  *
+ *  A saved partitioner is preceded in the stream by small sections that describe it: a @ref FUNCTION_TABLE section that
+ *  summarizes each function, and a @ref MEMORY_MAP section containing the partitioner's memory map. Tools that need only
+ *  this information can read these sections with @ref SerialInput::loadFunctionTable or @ref SerialInput::loadMemoryMap and
+ *  close the file without reading the rest of the partitioner, which is usually the bulk of the file. Since the memory map
+ *  section is shared with the partitioner that follows it, the map is stored only once.
+ *
  *  I/O errors are reported by throwing an @ref Exception. Errors thrown by underlying layers, such as Boost, are caught
  *  and rethrown as @ref Exception in order to simplify this interface.
  *
@@ -130,12 +139,64 @@ public:
         NO_OBJECT           = 0x00000000, /**< Object type for newly-initialized serializers. */
         PARTITIONER         = 0x00000001, /**< Rose::BinaryAnalysis::Partitioner2::Partitioner. */
         AST                 = 0x00000002, /**< Abstract syntax tree. */
+        MEMORY_MAP          = 0x00000003, /**< Memory map section preceding a partitioner. */
+        FUNCTION_TABLE      = 0x00000004, /**< Function summary section preceding a partitioner. */
         END_OF_DATA         = 0x0000fffe, /**< Marks the end of the data stream. */
         ERROR               = 0x0000ffff, /**< Marks that the stream has encountered an error condition. */
         USER_DEFINED        = 0x00010000, /**< First user-defined object number. */
         USER_DEFINED_LAST   = 0xffffffff  /**< Last user-defined object number. */
     };
 
+    /** Summary of one function.
+     *
+     *  These are the records stored in the @ref FUNCTION_TABLE section of a state file. They contain the information
+     *  needed to list functions without loading the partitioner. */
+    struct FunctionSummary {
+        rose_addr_t address = 0;                        /**< Entry address. */
+        std::string name;                               /**< Function name, possibly empty. */
+        std::string demangledName;                      /**< Demangled function name, possibly empty. */
+        rose_addr_t leastVa = 0;                        /**< Lowest address in the function's extent. */
+        rose_addr_t greatestVa = 0;                     /**< Highest address in the function's extent. */
+        bool isEmpty = true;                            /**< True if the function's extent is empty. */
+        size_t nIntervals = 0;                          /**< Number of contiguous intervals in the function's extent. */
+        size_t nBasicBlocks = 0;                        /**< Number of basic blocks. */
+        size_t nInstructions = 0;                       /**< Number of instructions in all basic blocks. */
+        size_t nDataBlocks = 0;                         /**< Number of data blocks. */
+        size_t nDataBlockBytes = 0;                     /**< Total size of all data blocks in bytes. */
+        size_t nCallsIn = 0;                            /**< Number of call graph edges into this function. */
+        size_t nCallsOut = 0;                           /**< Number of call graph edges out of this function. */
+
+#ifdef ROSE_HAVE_BOOST_SERIALIZATION_LIB
+    private:
+        friend class boost::serialization::access;
+
+        template<class S>
+        void serialize(S &s, const unsigned /*version*/) {
+            s & BOOST_SERIALIZATION_NVP(address);
+            s & BOOST_SERIALIZATION_NVP(name);
+            s & BOOST_SERIALIZATION_NVP(demangledName);
+            s & BOOST_SERIALIZATION_NVP(leastVa);
+            s & BOOST_SERIALIZATION_NVP(greatestVa);
+            s & BOOST_SERIALIZATION_NVP(isEmpty);
+            s & BOOST_SERIALIZATION_NVP(nIntervals);
+            s & BOOST_SERIALIZATION_NVP(nBasicBlocks);
+            s & BOOST_SERIALIZATION_NVP(nInstructions);
+            s & BOOST_SERIALIZATION_NVP(nDataBlocks);
+            s & BOOST_SERIALIZATION_NVP(nDataBlockBytes);
+            s & BOOST_SERIALIZATION_NVP(nCallsIn);
+            s & BOOST_SERIALIZATION_NVP(nCallsOut);
+        }
+#endif
+    };
+
+    /** Summaries for all functions. */
+    using FunctionTable = std::vector<FunctionSummary>;
+
+    /** Summarize the functions of a partitioner.
+     *
+     *  Returns one summary per function in the order returned by the partitioner's @c functions method. */
+    static FunctionTable summarizeFunctions(const Partitioner2::PartitionerConstPtr&);
+
     /** Errors thrown by this API. */
     class Exception: public Rose::Exception {
     public:
@@ -300,7 +361,8 @@ public:
     /** Save a binary analysis partitioner.
      *
      *  The specified partitioner, including all data reachable from the partitioner such as specimen data, instruction
-     *  ASTs, and analysis results, is written to the attached file.
+     *  ASTs, and analysis results, is written to the attached file. The partitioner is preceded by a @ref FUNCTION_TABLE
+     *  section and a @ref MEMORY_MAP section so that these can be read without reading the whole partitioner.
      *
      *  Throws an @ref Exception if the partitioner cannot be saved.
      *
@@ -478,12 +540,34 @@ public:
 
     /** Load a partitioner from the input stream.
      *
-     *  Initializes the specified partitioner with data from the input stream.
+     *  Initializes the specified partitioner with data from the input stream. Function table and memory map sections that
+     *  precede the partitioner are read as part of this operation.
      *
      *  Throws an @ref Exception if no file is attached to this I/O object or if the next object to be read from the
      *  input is not a partitioner, or if any other errors occur while reading the partitioner. */
     Partitioner2::PartitionerPtr loadPartitioner();
 
+    /** Load the function table from the input stream.
+     *
+     *  Returns summaries for the functions of the next partitioner in the stream. If the stream has a @ref FUNCTION_TABLE
+     *  section then only that section is read, otherwise the partitioner is loaded and summarized. In the former case the
+     *  stream is left positioned after the function table, so the memory map and the partitioner can still be read.
+     *
+     *  Throws an @ref Exception if no file is attached to this I/O object or if the next object in the input is neither a
+     *  function table nor a partitioner, or if any other errors occur while reading. */
+    FunctionTable loadFunctionTable();
+
+    /** Load the memory map from the input stream.
+     *
+     *  Returns the memory map for the next partitioner in the stream. Any function table section that precedes it is
+     *  skipped. If the stream has a @ref MEMORY_MAP section then only that section is read, otherwise the partitioner is
+     *  loaded and its memory map is returned. In the former case the stream is left positioned before the partitioner, which
+     *  can still be read and will share the same memory map.
+     *
+     *  Throws an @ref Exception if no file is attached to this I/O object or if the next object in the input is neither a
+     *  memory map nor a partitioner, or if any other errors occur while reading. */
+    MemoryMapPtr loadMemoryMap();
+
     /** Load an AST from the input stream.
      *
      *  Loads an AST from the intput stream and returns a pointer to its root. If a null AST was stored, then a null
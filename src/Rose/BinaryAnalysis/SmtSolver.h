@@ -532,6 +532,17 @@ public:
     virtual void insert(const ExprList&);
     /** @} */
 
+    /** Replace the backtracking levels above level zero.
+     *
+     *  The levels above level zero are made to hold the specified lists of assertions, one list per level. Leading levels that
+     *  already hold the same expressions (compared by pointer) as the corresponding lists are kept, and only the remaining
+     *  levels are popped and pushed. Unlike calling @ref reset followed by @ref insert, an incremental solver therefore
+     *  needs to encode only the assertions that changed, and it keeps whatever it learned about the unchanged levels.  This is
+     *  intended for checking many paths that share prefixes, with one list per path step. Level zero is not modified.
+     *
+     *  Returns the number of levels that were kept, not counting level zero. */
+    virtual size_t replaceLevels(const std::vector<ExprList>&);
+
     /** All assertions.
      *
      *  Returns the list of all assertions across all backtracking points. */
@@ -3,6 +3,7 @@
 #include <featureTests.h>
 #ifdef ROSE_ENABLE_BINARY_ANALYSIS
 
+#include <Rose/BinaryAnalysis/BasicTypes.h>
 #include <Rose/SourceLocation.h>
 
 #include <boost/filesystem.hpp>
@@ -97,6 +98,12 @@ public:
      *  source code and addresses and adds that information to this object. */
     void insertFromDebug(SgNode *ast);
 
+    /** Insert information from indexed debug tables.
+     *
+     *  Adds the mapping from addresses to source locations described by the line tables of the specified index. This
+     *  decodes the index's line tables if they haven't been decoded yet. */
+    void insertFromDebug(DwarfIndex&);
+
     /** Fill in small holes in the address space.
      *
      *  The DWARF information stored in a file typically maps source location to only the first virtual address for that source
@@ -140,6 +140,15 @@ struct Settings {
 
     std::string linePrefix;
 
+    /** Number of threads used to unparse all functions of a partitioner.
+     *
+     *  When unparsing a whole partitioner, functions can be rendered concurrently into separate buffers that are then
+     *  emitted in the same order as the serial unparser would have produced them, so the output is identical either way.
+     *  A value of one unparses serially, and zero means use the hardware concurrency. Unparsing is always serial when
+     *  instruction semantics are shown or when global margin arrows are present, since those carry state from one function
+     *  to the next. Unparsers that are chained to this one must be thread-safe if more than one thread is used. */
+    size_t nThreads;
+
     Settings();
     static Settings full();
     static Settings minimal();
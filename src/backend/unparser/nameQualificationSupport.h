@@ -21,6 +21,8 @@
 //    7) What about base class qualification? I might have forgotten this one! No this is handled using standard rules (above).
 
 
+#include <unordered_map>
+
 // API function for new hidden list support.
 void generateNameQualificationSupport( SgNode* node, std::set<SgNode*> & referencedNameSet );
 
@@ -187,11 +189,67 @@ class NameQualificationTraversal : public AstTopDownBottomUpProcessing<NameQuali
           namespaceAliasMapType namespaceAliasDeclarationMap;
 #endif
 
+       // Memoization of nameQualificationDepth() for declarations.  The amount of name qualification depends on the referenced
+       // declaration, the scope of the reference, and the position of the reference within that scope (for using declarations
+       // and prototypes that appear later in the scope), so all three form the key.  Results are only recorded when their
+       // evaluation did not also compute name qualification for template arguments (a side effect that must be repeated for
+       // each reference), and the cache is flushed whenever the referencedNameSet or the namespace alias map changes.
+          struct NameQualificationDepthKey
+             {
+               SgDeclarationStatement* declaration;
+               SgScopeStatement*       currentScope;
+               SgStatement*            positionStatement;
+
+               bool operator==(const NameQualificationDepthKey & X) const
+                  {
+                    return declaration == X.declaration && currentScope == X.currentScope && positionStatement == X.positionStatement;
+                  }
+             };
+
+          struct NameQualificationDepthKeyHash
+             {
+               size_t operator()(const NameQualificationDepthKey & key) const
+                  {
+                    size_t h = std::hash<void*>()(key.declaration);
+                    h ^= std::hash<void*>()(key.currentScope)      + 0x9e3779b97f4a7c15ULL + (h << 6) + (h >> 2);
+                    h ^= std::hash<void*>()(key.positionStatement) + 0x9e3779b97f4a7c15ULL + (h << 6) + (h >> 2);
+                    return h;
+                  }
+             };
+
+          typedef std::unordered_map<NameQualificationDepthKey,int,NameQualificationDepthKeyHash> NameQualificationDepthCache;
+          NameQualificationDepthCache nameQualificationDepthCache;
+
+       // Sizes of the referencedNameSet and the inaccessibleClassSets when the cache was last validated (both only ever grow).
+          size_t nameQualificationDepthCacheReferencedNameSetSize;
+          size_t nameQualificationDepthCacheInaccessibleClassSetsSize;
+
+       // True if neither the referencedNameSet nor the inaccessibleClassSets changed since the cache was last validated.
+          bool isNameQualificationDepthCacheCurrent() const;
+
+       // Incremented each time template argument name qualification is evaluated, used to detect impure evaluations.
+          size_t templateArgumentEvaluationCounter;
+
+       // Uncached implementation of nameQualificationDepth() for declarations.
+          int evaluateNameQualificationDepth ( SgDeclarationStatement* declaration, SgScopeStatement* currentScope, SgStatement* positionStatement );
+
+       // Discard memoized results (called when state that the results depend upon is modified).
+          void invalidateNameQualificationDepthCache();
+
      public:
        // DQ (3/24/2016): Adding Robb's meageage mechanism (data member and function).
        // static Sawyer::Message::Facility mlog;
           static void initDiagnostics();
 
+       // Enables memoization of nameQualificationDepth() results (default: true).  Memoization can be disabled to debug the
+       // name qualification; the generated code is the same either way.  Results are never memoized while template
+       // definitions are being visited (see MangledNameSupport::visitedTemplateDefinitions).
+          static bool useNameQualificationDepthCache;
+
+       // Statistics about the memoization of nameQualificationDepth(), accumulated over all traversals.
+          static size_t nameQualificationDepthCacheHits;
+          static size_t nameQualificationDepthCacheMisses;
+
      public:
        // DQ (4/3/2014): This map of sets is build once and then used to resolve when declarations have been
        // placed into scopes where they would permit name qualification (see test2014_32.C).
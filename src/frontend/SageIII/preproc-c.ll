@@ -1474,6 +1474,9 @@ ROSEAttributesList *getPreprocessorDirectives( std::string fileName, std::string
      TimingPerformance timer ("AST collect comments and CPP directives():");
 
      FILE *fp = NULL;
+     ROSEAttributesList *cachedListOfAttributes = NULL;
+     bool lexedFile = false;
+     uint64_t contentHash = 0;
      ROSEAttributesList *preprocessorInfoList = new ROSEAttributesList; // create a new list
      ROSE_ASSERT (preprocessorInfoList != NULL);
 
@@ -1558,6 +1561,18 @@ ROSEAttributesList *getPreprocessorDirectives( std::string fileName, std::string
              }
             else
              {
+            // Header files are included from many translation units, check if this file has already been lexed.
+               cachedListOfAttributes = ROSEAttributesListCache::lookup(fileName,new_filename,contentHash);
+               if (cachedListOfAttributes != NULL)
+                  {
+                    delete preprocessorInfoList;
+                    delete ROSE_token_stream_pointer;
+                    preprocessorInfoList      = cachedListOfAttributes;
+                    ROSE_token_stream_pointer = preprocessorInfoList->get_rawTokenStream();
+                    assert(ROSE_token_stream_pointer != NULL);
+                  }
+                 else
+                  {
                fp = fopen( fileName.c_str(), "r");
                if (fp)
                   {
@@ -1586,6 +1601,7 @@ ROSEAttributesList *getPreprocessorDirectives( std::string fileName, std::string
                  // The accumulator list should now be empty
                     assert (preprocessorList.getLength() == 0);
                     fclose(fp);  
+                    lexedFile = true;
                   }
                  else
                   {
@@ -1596,6 +1612,7 @@ ROSEAttributesList *getPreprocessorDirectives( std::string fileName, std::string
                  // ROSE_ASSERT(false);
                     ROSE_ASSERT(false);
                   }
+                  }
              }
         }
 
@@ -1606,6 +1623,12 @@ ROSEAttributesList *getPreprocessorDirectives( std::string fileName, std::string
   // DQ (11/3/2019): Make sure that the filename is filled in.
      ROSE_ASSERT(preprocessorInfoList->getFileName() != "");
 
+  // Save the result of the lex pass for other translation units that include this file.
+     if (lexedFile == true)
+        {
+          ROSEAttributesListCache::insert(fileName,new_filename,contentHash,preprocessorInfoList);
+        }
+
 #if DEBUG_LEX_PASS || 0
      printf ("Leaving getPreprocessorDirectives(fileName = %s): preprocessorInfoList->size() = %d \n",fileName.c_str(),(int)preprocessorInfoList->size());
      printf (" --- preprocessorInfoList->getFileName() = %s \n",preprocessorInfoList->getFileName().c_str());
@@ -6,6 +6,9 @@
 //#include <list>
 //#include <vector>
 #include <map>
+#include <stdint.h>
+#include <string>
+#include <vector>
 
 // Include the ROSE lex specific definitions of tokens
 #include "general_token_defs.h"
@@ -662,6 +665,92 @@ class ROSEAttributesListContainer
    };
 
 
+// Process-wide cache of the comments, CPP directives and raw token streams gathered by the lex pass over a file (see
+// getPreprocessorDirectives() in preproc-c.ll).  In a multi-file project the same header files are included from many
+// translation units; with this cache each unique header is lexed once.  Entries are keyed by the physical file name,
+// the (optional) non-physical file name used for the source positions, and a hash of the file contents, so a modified
+// file is lexed again.  The weaving of comments and CPP directives into the AST modifies the lists it is given, so
+// every lookup builds a new ROSEAttributesList from the cached records.  The cache can optionally be kept in a
+// directory so that it is shared between separate invocations of ROSE tools (e.g. the translation units of a build).
+class ROSEAttributesListCache
+   {
+     public:
+       // Returns a new list built from the cache, or NULL if the file has not been cached.  The hash of the file
+       // contents is returned so that it can be passed to insert() when the file must be lexed.
+          static ROSEAttributesList* lookup ( const std::string & fileName, const std::string & new_filename, uint64_t & contentHash );
+
+       // Records the list produced by the lex pass (the list itself is not retained).
+          static void insert ( const std::string & fileName, const std::string & new_filename, uint64_t contentHash, ROSEAttributesList* listOfAttributes );
+
+       // The cache is disabled by default since its entries are never evicted; it is enabled by the
+       // -rose:preprocessingInfoCache option.  When enabled, the on-disk cache is also used if a directory is specified
+       // (default is the value of the ROSE_PREPROCESSING_INFO_CACHE_DIR environment variable, if set).
+          static bool get_enabled();
+          static void set_enabled( bool enabled );
+          static std::string get_directory();
+          static void set_directory( const std::string & directory );
+
+       // Discards all in-memory entries.
+          static void clear();
+
+       // Number of in-memory entries.
+          static size_t get_size();
+
+       // Statistics for performance evaluation.
+          static size_t get_hits();
+          static size_t get_misses();
+
+       // Hash of the contents of a file (returns false if the file can not be read).
+          static bool hashFileContents ( const std::string & fileName, uint64_t & contentHash );
+
+     private:
+          struct DirectiveRecord
+             {
+               int         directiveType;
+               std::string text;
+               std::string filename;
+               int         line;
+               int         column;
+               int         numberOfLines;
+               int         relativePosition;
+             };
+
+          struct TokenRecord
+             {
+               bool          hasToken;
+               int           tokenId;
+               std::string   lexeme;
+               int64_t       directiveIndex;  // index into the directive records or -1
+               file_pos_info beginning;
+               file_pos_info ending;
+             };
+
+          struct Entry
+             {
+               uint64_t                     contentHash;
+               std::string                  listFileName;
+               bool                         hasTokenStream;
+               std::vector<DirectiveRecord> directives;
+               std::vector<TokenRecord>     tokens;
+             };
+
+          typedef std::map<std::pair<std::string,std::string>,Entry> EntryMap;
+
+          static EntryMap & entries();
+          static std::string cacheFileName ( const std::string & fileName, const std::string & new_filename );
+          static bool readEntry ( const std::string & fileName, const std::string & new_filename, uint64_t contentHash, Entry & entry );
+          static void writeEntry ( const std::string & fileName, const std::string & new_filename, const Entry & entry );
+          static ROSEAttributesList* buildList ( const Entry & entry );
+          static void buildEntry ( ROSEAttributesList* listOfAttributes, Entry & entry );
+
+          static bool        enabled;
+          static bool        directoryInitialized;
+          static std::string directory;
+          static size_t      hits;
+          static size_t      misses;
+   };
+
+
 // #ifndef USE_ROSE
 #ifndef ROSE_SKIP_COMPILATION_OF_WAVE
 
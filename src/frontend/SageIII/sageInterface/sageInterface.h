@@ -503,6 +503,16 @@ int64_t getAsmSignedConstant(SgAsmValueExpression *e);
   std::string getMangledNameFromCache (SgNode * astNode);
   std::string addMangledNameToCache (SgNode * astNode, const std::string & mangledName);
 
+  /*! \brief Thread-safe access to SgNode's global mangled name map.
+
+      The map memoizes the mangled name of each node. It must be cleared when names change so that stale mangled names are
+      not reused. These functions hold the same lock as getMangledNameFromCache and addMangledNameToCache and should be used
+      instead of SgNode::get_globalMangledNameMap and SgNode::clearGlobalMangledNameMap.
+   */
+  void clearGlobalMangledNameCache ();
+  size_t globalMangledNameCacheSize ();
+  bool isInGlobalMangledNameCache (SgNode * astNode);
+
   SgDeclarationStatement * getNonInstantiatonDeclarationForClass (SgTemplateInstantiationMemberFunctionDecl * memberFunctionInstantiation);
 
   //! a better version for SgVariableDeclaration::set_baseTypeDefininingDeclaration(), handling all side effects automatically
@@ -1,13 +1,25 @@
 #ifndef ASTJSONGENERATION_H
 #define ASTJSONGENERATION_H
 
+#include <set>
+
 class ROSE_DLL_API AstJSONGeneration {
  public:
-  AstJSONGeneration() {}
+  AstJSONGeneration() : maxDepth(0) {}
   void generate(std::string filename, SgNode* node);
   void generate(SgProject* projectNode);
   void generateInputFiles(SgProject* projectNode); // Generate within files for each project file
   void generateWithinFile(const std::string& filename, SgFile* node);
+
+  // Filters applied by all of the generate functions. Nodes more than maxDepth levels below the node where generation
+  // starts are neither traversed nor written (zero means no limit), and if the set of variants is not empty only the nodes
+  // of those variants are written. A single subtree is written by passing its root to generate(filename, node).
+  void set_maxDepth(size_t depth) { maxDepth = depth; }
+  void set_variants(const std::set<VariantT>& v) { variants = v; }
+
+ private:
+  size_t maxDepth;
+  std::set<VariantT> variants;
 };
 
 #endif // ASTJSONGENERATION_H
@@ -180,6 +180,9 @@ private:
 template <class InheritedAttributeType, class SynthesizedAttributeType>
 class AstCombinedTopDownBottomUpProcessing;
 
+template <class InheritedAttributeType, class SynthesizedAttributeType>
+class AstSharedMemoryParallelSubtreeOuterTraversal;
+
 template <class InheritedAttributeType, class SynthesizedAttributeType>
 class AstTopDownBottomUpProcessing
     : public SgTreeTraversal<InheritedAttributeType, SynthesizedAttributeType>
@@ -204,6 +207,7 @@ public:
     
 
     friend class AstCombinedTopDownBottomUpProcessing<InheritedAttributeType, SynthesizedAttributeType>;
+    friend class AstSharedMemoryParallelSubtreeOuterTraversal<InheritedAttributeType, SynthesizedAttributeType>;
 
 protected:
     //! pure virtual function which must be implemented to compute the inherited attribute at a node
@@ -982,6 +986,7 @@ atTraversalEnd()
 //      -fpermissive to compile without error (and then it generates a lot of warnings).
 #if !_MSC_VER
   #include "AstSharedMemoryParallelProcessing.h"
+  #include "AstSharedMemoryParallelSubtreeProcessing.h"
 #endif
 
 #endif
@@ -0,0 +1,132 @@
+// Classes for shared-memory (multithreaded) parallel evaluation of a single AST traversal.
+
+#ifndef ASTSHAREDMEMORYPARALLELSUBTREEPROCESSING_H
+#define ASTSHAREDMEMORYPARALLELSUBTREEPROCESSING_H
+
+#include "AstProcessing.h"
+#include "AstSimpleProcessing.h"
+
+#include <functional>
+#include <map>
+#include <vector>
+
+// The classes in AstSharedMemoryParallelProcessing.h run several different traversals in lock-step over the same AST, so
+// a single traversal never runs on more than one thread. The classes in this file instead split the work of one
+// traversal over independent subtrees of the AST. The nodes outside of those subtrees (the "outer" part of the AST,
+// usually just the global scopes, namespaces and classes) are visited by the calling thread, and each subtree (by
+// default, each function definition) is a task that is run by the next available thread.
+//
+// Subtree roots are not nested: once a subtree root is found its whole subtree belongs to that task, including any
+// nested subtree roots such as the member functions of local classes.
+
+// Base class that finds the subtree roots and runs the tasks.
+class ROSE_DLL_API AstSharedMemoryParallelSubtreeProcessing
+{
+public:
+    // Use the specified number of threads; zero means one thread per hardware thread.
+    AstSharedMemoryParallelSubtreeProcessing(size_t threads = 0);
+    virtual ~AstSharedMemoryParallelSubtreeProcessing();
+
+    void set_numberOfThreads(size_t threads);
+    size_t get_numberOfThreads() const;
+
+    // Predicate that determines the granularity of the tasks. Returns true for nodes whose subtrees are traversed as
+    // separate tasks. The default selects function definitions; override it to select, for instance, SgSourceFile nodes
+    // to run one task per file. The node where the traversal starts is never treated as a subtree root.
+    virtual bool isSubtreeRoot(SgNode *node) const;
+
+protected:
+    // Runs task(0) through task(nTasks-1), each exactly once, on up to get_numberOfThreads() threads. Tasks are handed out
+    // in order as threads become available. If a task throws, no further tasks are started and the first exception is
+    // rethrown in the calling thread after all running tasks have finished.
+    void runTasks(size_t nTasks, const std::function<void(size_t)> &task) const;
+
+private:
+    size_t numberOfThreads;
+};
+
+// Parallel evaluation of an AstSimpleProcessing traversal. The traversal's visit() function is called concurrently from
+// several threads, so this is only done for traversals whose isThreadSafe() returns true; other traversals are simply run
+// by traverse(). For a preorder traversal the nodes outside the subtrees are visited before the subtrees, and for a
+// postorder traversal they are visited after them. The order in which the nodes of different subtrees are visited is
+// unspecified.
+class ROSE_DLL_API AstSharedMemoryParallelSubtreeSimpleProcessing
+    : public AstSharedMemoryParallelSubtreeProcessing
+{
+public:
+    AstSharedMemoryParallelSubtreeSimpleProcessing(size_t threads = 0);
+
+    void traverseInParallel(AstSimpleProcessing *traversal, SgNode *basenode, t_traverseOrder treeTraverseOrder);
+};
+
+// Parallel evaluation of an AstTopDownBottomUpProcessing traversal. TraversalType is the concrete (copyable) traversal
+// class, derived from AstTopDownBottomUpProcessing<InheritedAttributeType, SynthesizedAttributeType>.
+//
+// The traversal object passed to traverseInParallel() evaluates the attributes of the nodes outside the subtrees. Each
+// subtree is traversed by a copy of that object, made when the task starts, with the inherited attribute that its root
+// would have received in a sequential traversal. The synthesized attribute returned for each subtree is passed to the
+// evaluateSynthesizedAttribute() call of its parent exactly as in a sequential traversal, so the final result is the
+// same as that of traverse() for traversals that communicate only through their attributes. Changes that the copies make
+// to their own data members are discarded with the copies.
+//
+// Every node's inherited attribute is evaluated exactly once, and so is every node's synthesized attribute, but all the
+// inherited attributes of the outer nodes are evaluated before any subtree is traversed, and all their synthesized
+// attributes after the subtrees are finished.
+template <class TraversalType, class InheritedAttributeType, class SynthesizedAttributeType>
+class AstSharedMemoryParallelSubtreeTopDownBottomUpProcessing
+    : public AstSharedMemoryParallelSubtreeProcessing
+{
+public:
+    AstSharedMemoryParallelSubtreeTopDownBottomUpProcessing(size_t threads = 0);
+
+    SynthesizedAttributeType traverseInParallel(TraversalType &traversal, SgNode *basenode,
+            InheritedAttributeType inheritedValue);
+};
+
+// --------- Implementor Line - Do Not Cross ---------
+
+// Traversal of the nodes outside the subtrees on behalf of a user's top-down bottom-up traversal. The first pass (in
+// preorder) evaluates and records the inherited attributes and collects the subtree roots; the second pass (in pre- and
+// postorder) evaluates the synthesized attributes, using the recorded inherited attributes and the subtree results.
+template <class InheritedAttributeType, class SynthesizedAttributeType>
+class AstSharedMemoryParallelSubtreeOuterTraversal
+    : public SgTreeTraversal<InheritedAttributeType, SynthesizedAttributeType>
+{
+public:
+    typedef SgTreeTraversal<InheritedAttributeType, SynthesizedAttributeType> Superclass;
+    typedef typename Superclass::SynthesizedAttributesList SynthesizedAttributesList;
+    typedef typename Superclass::SuccessorsContainer SuccessorsContainer;
+
+    AstSharedMemoryParallelSubtreeOuterTraversal(
+            AstTopDownBottomUpProcessing<InheritedAttributeType, SynthesizedAttributeType> *traversal,
+            const AstSharedMemoryParallelSubtreeProcessing *subtrees,
+            SgNode *basenode);
+
+    void collect(InheritedAttributeType inheritedValue);
+    SynthesizedAttributeType evaluate(InheritedAttributeType inheritedValue);
+
+    std::vector<SgNode *> roots;
+    std::vector<InheritedAttributeType> rootInheritedValues;
+    std::vector<SynthesizedAttributeType> rootResults;
+
+protected:
+    virtual InheritedAttributeType evaluateInheritedAttribute(SgNode *node, InheritedAttributeType inheritedValue);
+    virtual SynthesizedAttributeType evaluateSynthesizedAttribute(SgNode *node, InheritedAttributeType inheritedValue,
+            SynthesizedAttributesList synthesizedAttributes);
+    virtual SynthesizedAttributeType defaultSynthesizedAttribute(InheritedAttributeType inheritedValue);
+    virtual void setNodeSuccessors(SgNode *node, SuccessorsContainer &succContainer);
+
+private:
+    bool isCut(SgNode *node) const;
+
+    AstTopDownBottomUpProcessing<InheritedAttributeType, SynthesizedAttributeType> *traversal;
+    const AstSharedMemoryParallelSubtreeProcessing *subtrees;
+    SgNode *basenode;
+    bool evaluating;
+    size_t nextRoot;
+    std::map<SgNode *, InheritedAttributeType> inheritedValues;
+};
+
+#include "AstSharedMemoryParallelSubtreeProcessingImpl.h"
+
+#endif
@@ -0,0 +1,140 @@
+#ifndef ASTSHAREDMEMORYPARALLELSUBTREEPROCESSING_C
+#define ASTSHAREDMEMORYPARALLELSUBTREEPROCESSING_C
+
+#include "AstSharedMemoryParallelSubtreeProcessing.h"
+
+// Throughout this file, T is the concrete TraversalType, I is the InheritedAttributeType, and S is the
+// SynthesizedAttributeType
+
+// parallel TOP DOWN BOTTOM UP implementation
+
+template <class T, class I, class S>
+AstSharedMemoryParallelSubtreeTopDownBottomUpProcessing<T, I, S>::
+AstSharedMemoryParallelSubtreeTopDownBottomUpProcessing(size_t threads)
+    : AstSharedMemoryParallelSubtreeProcessing(threads)
+{
+}
+
+template <class T, class I, class S>
+S
+AstSharedMemoryParallelSubtreeTopDownBottomUpProcessing<T, I, S>::
+traverseInParallel(T &traversal, SgNode *basenode, I inheritedValue)
+{
+    if (get_numberOfThreads() == 1)
+        return traversal.traverse(basenode, inheritedValue);
+
+    AstSharedMemoryParallelSubtreeOuterTraversal<I, S> outer(&traversal, this, basenode);
+    outer.collect(inheritedValue);
+
+    // Each task traverses its subtree with a private copy of the traversal since the traversal's stack of synthesized
+    // attributes is part of the object.
+    std::vector<S> results(outer.roots.size());
+    runTasks(outer.roots.size(), [&traversal, &outer, &results](size_t i) {
+            T copy(traversal);
+            results[i] = copy.traverse(outer.roots[i], outer.rootInheritedValues[i]);
+        });
+
+    outer.rootResults.swap(results);
+    return outer.evaluate(inheritedValue);
+}
+
+template <class I, class S>
+AstSharedMemoryParallelSubtreeOuterTraversal<I, S>::
+AstSharedMemoryParallelSubtreeOuterTraversal(AstTopDownBottomUpProcessing<I, S> *traversal,
+        const AstSharedMemoryParallelSubtreeProcessing *subtrees, SgNode *basenode)
+    : traversal(traversal), subtrees(subtrees), basenode(basenode), evaluating(false), nextRoot(0)
+{
+    ROSE_ASSERT(traversal != NULL);
+    ROSE_ASSERT(subtrees != NULL);
+
+    // The successors of subtree roots are hidden from this traversal, so it can't use the index-based mechanism.
+    Superclass::set_useDefaultIndexBasedTraversal(false);
+}
+
+template <class I, class S>
+void
+AstSharedMemoryParallelSubtreeOuterTraversal<I, S>::collect(I inheritedValue)
+{
+    evaluating = false;
+    traversal->atTraversalStart();
+    Superclass::traverse(basenode, inheritedValue, preorder);
+}
+
+template <class I, class S>
+S
+AstSharedMemoryParallelSubtreeOuterTraversal<I, S>::evaluate(I inheritedValue)
+{
+    ROSE_ASSERT(rootResults.size() == roots.size());
+    evaluating = true;
+    nextRoot = 0;
+    S result = Superclass::traverse(basenode, inheritedValue, preandpostorder);
+    ROSE_ASSERT(nextRoot == roots.size());
+    traversal->atTraversalEnd();
+    return result;
+}
+
+template <class I, class S>
+bool
+AstSharedMemoryParallelSubtreeOuterTraversal<I, S>::isCut(SgNode *node) const
+{
+    return node != basenode && subtrees->isSubtreeRoot(node);
+}
+
+template <class I, class S>
+I
+AstSharedMemoryParallelSubtreeOuterTraversal<I, S>::evaluateInheritedAttribute(SgNode *node, I inheritedValue)
+{
+    if (isCut(node))
+    {
+        // The task evaluates the root's own inherited attribute from the value its parent passes down.
+        if (!evaluating)
+        {
+            roots.push_back(node);
+            rootInheritedValues.push_back(inheritedValue);
+        }
+        return inheritedValue;
+    }
+
+    if (!evaluating)
+    {
+        I result = traversal->evaluateInheritedAttribute(node, inheritedValue);
+        inheritedValues.insert(std::make_pair(node, result));
+        return result;
+    }
+
+    typename std::map<SgNode *, I>::const_iterator i = inheritedValues.find(node);
+    ROSE_ASSERT(i != inheritedValues.end());
+    return i->second;
+}
+
+template <class I, class S>
+S
+AstSharedMemoryParallelSubtreeOuterTraversal<I, S>::evaluateSynthesizedAttribute(SgNode *node, I inheritedValue,
+        SynthesizedAttributesList synthesizedAttributes)
+{
+    // Subtrees are disjoint, so their roots are reached in the same order in postorder as in preorder.
+    if (isCut(node))
+    {
+        ROSE_ASSERT(nextRoot < rootResults.size() && roots[nextRoot] == node);
+        return rootResults[nextRoot++];
+    }
+
+    return traversal->evaluateSynthesizedAttribute(node, inheritedValue, synthesizedAttributes);
+}
+
+template <class I, class S>
+S
+AstSharedMemoryParallelSubtreeOuterTraversal<I, S>::defaultSynthesizedAttribute(I inheritedValue)
+{
+    return traversal->defaultSynthesizedAttribute(inheritedValue);
+}
+
+template <class I, class S>
+void
+AstSharedMemoryParallelSubtreeOuterTraversal<I, S>::setNodeSuccessors(SgNode *node, SuccessorsContainer &succContainer)
+{
+    if (!isCut(node))
+        traversal->setNodeSuccessors(node, succContainer);
+}
+
+#endif
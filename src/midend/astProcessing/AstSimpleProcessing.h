@@ -55,6 +55,8 @@ private:
 // AstPrePostProcessing, but that results in a (barely) measurable
 // performance hit.
 class AstCombinedSimpleProcessing;
+class AstSharedMemoryParallelSubtreeSimpleProcessing;
+class AstSharedMemoryParallelSubtreeSimpleTraversal;
 
 class ROSE_DLL_API AstSimpleProcessing
     : public SgTreeTraversal<DummyAttribute, DummyAttribute>
@@ -71,7 +73,13 @@ public:
     //! traverse only nodes which represent files which were specified on the command line (=input files).
     void traverseInputFiles(SgProject* projectNode, Order treeTraversalOrder);
 
+    //! Whether visit() may be called concurrently from several threads. Traversals that return true are split over
+    //! subtrees by AstSharedMemoryParallelSubtreeSimpleProcessing; the default is false.
+    virtual bool isThreadSafe() const;
+
     friend class AstCombinedSimpleProcessing;
+    friend class AstSharedMemoryParallelSubtreeSimpleProcessing;
+    friend class AstSharedMemoryParallelSubtreeSimpleTraversal;
 
 protected:
     //! this method is called at every traversed node.
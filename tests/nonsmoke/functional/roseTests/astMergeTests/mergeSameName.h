@@ -0,0 +1,5 @@
+// Declarations that both translation units see at the same position, so the merge shares them.
+
+int shared_function(int);
+
+extern int shared_variable;
@@ -0,0 +1,24 @@
+/* Specimen with DWARF-5 line tables for testDwarfIndex. The source is named with a relative directory so that the line table
+ * has a directory entry other than the compilation directory. Compile in this directory as:
+ *   gcc -static -nostdlib -nostartfiles -O0 -gdwarf-5 -fno-asynchronous-unwind-tables \
+ *       -fdebug-prefix-map=$(pwd)=/specimens/binary -o x86-64-dwarf5 -Wl,-e_start -Wl,--build-id=none ../binary/x86-64-dwarf5.c
+ */
+#include "x86-64-dwarf5.h"
+
+static int
+sum(int n) {
+    int total = 0;
+    for (int i = 0; i < n; ++i)
+        total = add(total, i);
+    return total;
+}
+
+void
+_start() {
+    int status = sum(10) == 45 ? 0 : 1;
+    asm("syscall"
+        : /* no output */
+        : "D"(status), "a"(60)
+        :
+        );
+}
@@ -0,0 +1,5 @@
+/* Header for x86-64-dwarf5.c. Its inline function puts rows for a second file into the line table. */
+static inline int
+add(int a, int b) {
+    return a + b;
+}
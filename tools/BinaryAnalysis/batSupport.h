@@ -11,9 +11,11 @@
 #include <boost/filesystem.hpp>
 #include <boost/lexical_cast.hpp>
 #include <fstream>
+#include <functional>
 #include <map>
 #include <Sawyer/CommandLine.h>
 #include <Sawyer/Message.h>
+#include <Sawyer/ProgressBar.h>
 #include <set>
 #include <string>
 
@@ -559,6 +561,56 @@ public:
     void printStatistics(std::ostream&, const std::string &prefix = "") const;
 };
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Memory scanning
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/** Block of memory passed to a memory scanner.
+ *
+ *  A block describes a run of equally spaced scan positions and holds a copy of the specimen bytes from the first position
+ *  through the lookahead area after the last position. */
+struct MemoryBlock {
+    rose_addr_t va = 0;                                 /**< Address of the first position and of @c data[0]. */
+    size_t step = 1;                                    /**< Distance in bytes between consecutive positions. */
+    size_t nPositions = 0;                              /**< Number of positions in this block. */
+    std::vector<uint8_t> data;                          /**< Bytes starting at @ref va, possibly short at the end of memory. */
+
+    /** Address of the specified position. */
+    rose_addr_t positionVa(size_t i) const {
+        return va + i * step;
+    }
+
+    /** Offset into @ref data for the specified position. */
+    size_t positionOffset(size_t i) const {
+        return i * step;
+    }
+
+    /** Number of bytes available in @ref data at the specified position. */
+    size_t nBytesAt(size_t i) const {
+        return positionOffset(i) < data.size() ? data.size() - positionOffset(i) : 0;
+    }
+};
+
+/** Function that scans one memory block and returns its output. */
+using MemoryBlockScanner = std::function<std::string(const MemoryBlock&)>;
+
+/** Scan memory in large blocks.
+ *
+ *  The scan positions are chosen separately in each interval of @p regions: the first position is the lowest address in the
+ *  interval aligned to @p alignment (zero or one means no alignment), and subsequent positions are @p step bytes apart. A
+ *  position is used only if at least @p minBytes bytes of the interval start at that position. Each block contains at most
+ *  @p blockPositions positions and is read from the memory map with a single read that includes up to @p lookahead bytes
+ *  starting at the last position, stopping early where the map has no data.
+ *
+ *  The blocks are scanned by up to @p nThreads threads (zero means use the hardware concurrency) and the strings returned by
+ *  the scanner are written to @p out in address order, so the output doesn't depend on the number of threads. Each thread
+ *  uses its own copy of the scanner, so scanners can lazily allocate per-thread resources. If a progress bar is supplied, it
+ *  is advanced by the number of positions scanned. */
+void
+scanMemory(std::ostream &out, const Rose::BinaryAnalysis::MemoryMapPtr&, const AddressIntervalSet &regions,
+           rose_addr_t alignment, size_t step, size_t minBytes, size_t lookahead, size_t blockPositions, size_t nThreads,
+           const MemoryBlockScanner&, Sawyer::ProgressBar<size_t> *progress = nullptr);
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Instruction histograms
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -3,6 +3,7 @@
 
 #include <vector>
 #include <string>
+#include <cstdint>
 #include "Labeler.h"
 
 namespace CodeThorn {
@@ -10,6 +11,11 @@ namespace CodeThorn {
      A CallString is used as context in inter-procedural analysis. It
      consists of Labels that are associated with the function calls in
      an analyzed program.
+
+     Call strings are interned: all call strings are stored in one
+     trie, and a CallString only holds the id of its trie node. Copying,
+     hashing, and comparing call strings for equality therefore take
+     constant time, independent of the length of the call string.
   */
   class CallString {
   public:
@@ -73,7 +79,10 @@ namespace CodeThorn {
   private:
     static size_t _maxLength;
     typedef std::vector<CodeThorn::Label> CallStringType;
-    CallStringType _callString;
+    // labels of the call string, from the first to the last call
+    CallStringType labels() const;
+    // id of the trie node representing this call string, 0 is the empty call string
+    uint32_t _id=0;
   };
 
 }
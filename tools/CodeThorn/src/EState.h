@@ -7,6 +7,7 @@
 #include <set>
 #include <map>
 #include <utility>
+#include <atomic>
 #include "Labeler.h"
 #include "CFAnalysis.h"
 #include "AbstractValue.h"
@@ -110,8 +111,8 @@ namespace CodeThorn {
   public:
     CodeThorn::InputOutput io;
   private:
-    static uint64_t _constructCount;
-    static uint64_t _destructCount;
+    static std::atomic<uint64_t> _constructCount; // atomic, because states are created and deleted by parallel solvers
+    static std::atomic<uint64_t> _destructCount;
     static std::list<std::pair<uint64_t,uint64_t> > _allocationHistory;
     
   };
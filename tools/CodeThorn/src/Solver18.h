@@ -8,6 +8,9 @@
 #include "GeneralPriorityWorkList.h"
 #include "Label.h"
 #include "CallString.h"
+#include <omp.h>
+#include <mutex>
+#include <condition_variable>
 
 namespace CodeThorn {
 
@@ -75,6 +78,21 @@ namespace CodeThorn {
     bool isRegisteredTransferFunctionInvoked(Label lab);
     
     LabelSet _transferFunctionInvoked; // labels for which a transfer function has been invoked
+
+    void runSerial();
+    // multi-threaded variant of runSerial, used if more than one thread is selected (option --threads)
+    void runParallel(int workers);
+    // merges a state computed by a transfer function into the stored state of its label and call string,
+    // returns true if the stored state has changed. Only used by runParallel.
+    bool mergeAbstractStateLocked(EStatePtr newEStatePtr);
+    void pushParallel(WorkListEntry entry);
+    // applies the transfer functions to the state of the entry, returns the number of transfers. Only used by runParallel.
+    size_t processWorkListEntryParallel(WorkListEntry p);
+    std::vector<omp_lock_t> _labelLocks; // one lock per label, only used by runParallel
+    // protects the work list and _activeWorkers in runParallel; idle threads wait on _workListChanged
+    std::mutex _workListMutex;
+    std::condition_variable _workListChanged;
+    size_t _activeWorkers=0; // number of threads that are processing a work list entry and can add new entries
   };
 
 } // end of namespace CodeThorn
@@ -2,6 +2,8 @@
 #define TRANSITION_GRAPH
 
 #include "EState.h"
+#include <unordered_map>
+#include <vector>
 
 namespace CodeThorn {
   /*! 
@@ -99,10 +101,19 @@ namespace CodeThorn {
     // generates info about #transitions and details about states in CSV format
     void csvToStream(std::stringstream& csvStream);
   private:
+    // The in- and out-edges of each state are kept in vectors sorted in the order of TransitionPtrSet. On large graphs
+    // this takes a fraction of the memory of a set (one pointer per edge instead of one tree node). States without
+    // edges have no entry.
+    typedef std::vector<const Transition*> TransitionPtrVector;
+    typedef std::unordered_map<EStatePtr,TransitionPtrVector> EdgeIndex;
+    static void insertIntoEdgeIndex(EdgeIndex& index, EStatePtr estate, const Transition* transp);
+    static void eraseFromEdgeIndex(EdgeIndex& index, EStatePtr estate, const Transition* transp);
+    static TransitionPtrSet edgesOf(const EdgeIndex& index, EStatePtr estate);
+
     Label _startLabel;
     int _numberOfNodes; // not used yet
-    std::map<EStatePtr,TransitionPtrSet > _inEdges;
-    std::map<EStatePtr,TransitionPtrSet > _outEdges;
+    EdgeIndex _inEdges;
+    EdgeIndex _outEdges;
     std::set<EStatePtr> _recomputedestateSet;
     bool _preciseSTG;
     bool _completeSTG;